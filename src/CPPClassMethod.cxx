@@ -48,3 +48,23 @@ PyObject* CPyCppyy::CPPClassMethod::Call(CPPInstance*&
 // execute function
     return this->Execute(nullptr, 0, ctxt);
 }
+
+//----------------------------------------------------------------------------
+CPyCppyy::EMatch CPyCppyy::CPPClassMethod::Match(CPPInstance*
+#if PY_VERSION_HEX >= 0x03080000
+    self
+#endif
+    , CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds)
+{
+// estimate only if the arguments are used as-is (see Call() for dropping a bound self)
+    if (kwds)
+        return kMatchUnknown;
+
+#if PY_VERSION_HEX >= 0x03080000
+    if ((!self || (PyObject*)self == Py_None) && CPyCppyy_PyArgs_GET_SIZE(args, nargsf) && \
+            CPPInstance_Check(CPyCppyy_PyArgs_GET_ITEM(args, 0)))
+        return kMatchUnknown;
+#endif
+
+    return this->MatchArgs(args, nargsf);
+}
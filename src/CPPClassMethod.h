@@ -14,6 +14,7 @@ public:
     virtual PyCallable* Clone() { return new CPPClassMethod(*this); }
     virtual PyObject* Call(CPPInstance*& self,
         CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds, CallContext* ctxt = nullptr);
+    virtual EMatch Match(CPPInstance* self, CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds);
 };
 
 } // namespace CPyCppyy
@@ -172,6 +172,28 @@ PyObject* CPyCppyy::CPPConstructor::Call(CPPInstance*& self,
     return nullptr;
 }
 
+//----------------------------------------------------------------------------
+CPyCppyy::EMatch CPyCppyy::CPPConstructor::Match(CPPInstance* self,
+    CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds)
+{
+// estimate only for direct construction: Python-derived classes forward the arguments
+// to their dispatcher, which has its own constructors
+    if (kwds)
+        return kMatchUnknown;
+
+    Py_ssize_t ifirst = 0;
+    if (!self && CPyCppyy_PyArgs_GET_SIZE(args, nargsf) && \
+            CPPInstance_Check(CPyCppyy_PyArgs_GET_ITEM(args, 0))) {
+        self = (CPPInstance*)CPyCppyy_PyArgs_GET_ITEM(args, 0);
+        ifirst = 1;
+    }
+
+    if (!self || self->ObjectIsA() != GetScope() || self->ObjectIsA(false) != GetScope())
+        return kMatchUnknown;
+
+    return this->MatchArgs(args, nargsf, ifirst);
+}
+
 
 //----------------------------------------------------------------------------
 CPyCppyy::CPPMultiConstructor::CPPMultiConstructor(Cppyy::TCppScope_t scope, Cppyy::TCppMethod_t method) :
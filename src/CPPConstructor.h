@@ -19,6 +19,7 @@ public:
     virtual PyCallable* Clone() { return new CPPConstructor(*this); }
     virtual PyObject* Call(CPPInstance*& self,
         CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds, CallContext* ctxt = nullptr);
+    virtual EMatch Match(CPPInstance* self, CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds);
 
 protected:
     virtual bool InitExecutor_(Executor*&, CallContext* ctxt = nullptr);
@@ -36,6 +37,7 @@ public:
     virtual PyCallable* Clone() { return new CPPMultiConstructor(*this); }
     virtual PyObject* Call(CPPInstance*& self,
         CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds, CallContext* ctxt = nullptr);
+    virtual EMatch Match(CPPInstance*, CPyCppyy_PyArgs_t, size_t, PyObject*) { return kMatchUnknown; }
 
 private:
     Py_ssize_t fNumBases;
@@ -102,6 +102,16 @@ PyObject* CPyCppyy::CPPFunction::Call(CPPInstance*& self,
     return result;
 }
 
+//-------------------------------------------------------------------------------
+CPyCppyy::EMatch CPyCppyy::CPPFunction::Match(CPPInstance* self,
+    CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds)
+{
+// estimate only if the arguments are used as-is (no rebound self, no keywords)
+    if (self || kwds)
+        return kMatchUnknown;
+    return this->MatchArgs(args, nargsf);
+}
+
 
 //- CPPReverseBinary private helper ---------------------------------------------
 bool CPyCppyy::CPPReverseBinary::ProcessArgs(PyCallArgs& cargs)
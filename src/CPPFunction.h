@@ -15,6 +15,7 @@ public:
     virtual PyCallable* Clone() { return new CPPFunction(*this); }
     virtual PyObject* Call(CPPInstance*& self,
         CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds, CallContext* ctxt = nullptr);
+    virtual EMatch Match(CPPInstance* self, CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds);
 
 protected:
     virtual bool ProcessArgs(PyCallArgs& args);
@@ -28,6 +29,7 @@ public:
     virtual PyCallable* Clone() { return new CPPFunction(*this); }
     virtual PyObject* Call(CPPInstance*& self,
         CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds, CallContext* ctxt = nullptr);
+    virtual EMatch Match(CPPInstance*, CPyCppyy_PyArgs_t, size_t, PyObject*) { return kMatchUnknown; }
 
 protected:
     virtual bool ProcessArgs(PyCallArgs& args);
@@ -13,6 +13,7 @@ public:
 
 public:
     virtual PyCallable* Clone() { return new CPPSetItem(*this); }
+    virtual EMatch Match(CPPInstance*, CPyCppyy_PyArgs_t, size_t, PyObject*) { return kMatchUnknown; }
 
 protected:
     virtual bool ProcessArgs(PyCallArgs& args);
@@ -25,6 +26,7 @@ public:
 
 public:
     virtual PyCallable* Clone() { return new CPPGetItem(*this); }
+    virtual EMatch Match(CPPInstance*, CPyCppyy_PyArgs_t, size_t, PyObject*) { return kMatchUnknown; }
 
 protected:
     virtual bool ProcessArgs(PyCallArgs& args);
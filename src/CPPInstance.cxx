@@ -6,6 +6,7 @@
 #include "MemoryRegulator.h"
 #include "ProxyWrappers.h"
 #include "PyStrings.h"
+#include "Threading.h"
 #include "TypeManip.h"
 #include "Utility.h"
 
@@ -14,6 +15,7 @@
 // Standard
 #include <algorithm>
 #include <sstream>
+#include <string.h>
 
 
 //- data _____________________________________________________________________
@@ -21,6 +23,20 @@ namespace CPyCppyy {
     extern PyObject* gNullPtrObject;
 }
 
+// Proxies of C++ classes are recycled through a free list per class, as is done in
+// CPython for its builtin types. The managed dictionary layout of p3.13 and later is
+// not handled, nor is concurrent use w/o the GIL.
+#if !defined(CPYCPPYY_FREE_THREADED) && PY_VERSION_HEX < 0x030D0000
+#define CPYCPPYY_INSTANCE_FREELIST 1
+#endif
+#ifndef CPYCPPYY_INSTANCE_MAXFREELIST
+#define CPYCPPYY_INSTANCE_MAXFREELIST 64
+#endif
+
+static uint64_t gFreeListHits   = 0;
+static uint64_t gFreeListMisses = 0;
+static size_t   gFreeListSize   = 0;
+
 //______________________________________________________________________________
 //                          Python-side proxy objects
 //                          =========================
@@ -38,6 +54,10 @@ namespace CPyCppyy {
 // Smart pointers have the underlying type as the Python type, but store the
 // pointer to the smart pointer. They carry a pointer to the Python-sode smart
 // class for dereferencing to get to the actual instance pointer.
+//
+// Small, trivially copyable objects returned by value may be held inline
+// (kIsInline set), i.e. in storage that is allocated as part of the proxy
+// itself (see BindCppValueInline), rather than in a separate C++ allocation.
 
 
 //- private helpers ----------------------------------------------------------
@@ -166,6 +186,25 @@ void CPyCppyy::CPPInstance::PythonOwns()
 //----------------------------------------------------------------------------
 void CPyCppyy::CPPInstance::CppOwns()
 {
+// an object held inline can not outlive its proxy, so move it to the heap first (the
+// C++ address changes, which is fine for the ownership transfer use cases)
+    if (fFlags & kIsInline) {
+        Cppyy::TCppType_t klass = ObjectIsA(false /* check_smart */);
+        void*& cppobj = GetObjectRaw();
+
+        bool isRegulated = fFlags & kIsRegulated;
+        if (isRegulated)
+            MemoryRegulator::UnregisterPyObject(this, (PyObject*)Py_TYPE((PyObject*)this));
+
+        void* heapobj = Cppyy::Allocate(klass);
+        memcpy(heapobj, cppobj, Cppyy::SizeOf(klass));    // trivially copyable
+        cppobj = heapobj;
+        fFlags &= ~kIsInline;
+
+        if (isRegulated)
+            MemoryRegulator::RegisterPyObject(this, heapobj);
+    }
+
     fFlags &= ~kIsOwner;
     if ((fFlags & kIsExtended) && DISPATCHPTR(this))
         DISPATCHPTR(this)->CppOwns();
@@ -214,7 +253,8 @@ void CPyCppyy::op_dealloc_nofree(CPPInstance* pyobj) {
     if (pyobj->fFlags & CPPInstance::kIsRegulated)
         MemoryRegulator::UnregisterPyObject(pyobj, (PyObject*)Py_TYPE((PyObject*)pyobj));
 
-    if (cppobj && (pyobj->fFlags & CPPInstance::kIsOwner)) {
+// objects held inline are trivially destructible and go away with the proxy
+    if (cppobj && (pyobj->fFlags & CPPInstance::kIsOwner) && !(pyobj->fFlags & CPPInstance::kIsInline)) {
         if (pyobj->fFlags & CPPInstance::kIsValue) {
             Cppyy::CallDestructor(klass, cppobj);
             Cppyy::Deallocate(klass, cppobj);
@@ -227,6 +267,25 @@ void CPyCppyy::op_dealloc_nofree(CPPInstance* pyobj) {
     pyobj->fFlags = CPPInstance::kNoWrapConv;
 }
 
+//----------------------------------------------------------------------------
+void CPyCppyy::ClearInstanceFreeList(CPPClass* klass)
+{
+// Release the recycled proxies of klass (called when the class goes away).
+    while (klass->fFreeList) {
+        PyObject* pyobj = klass->fFreeList;
+        klass->fFreeList = (PyObject*)((CPPInstance*)pyobj)->fObject;
+        PyObject_GC_Del(pyobj);
+    }
+    gFreeListSize -= klass->fNFree;
+    klass->fNFree = 0;
+}
+
+//----------------------------------------------------------------------------
+CPyCppyy::InstanceFreeListStats_t CPyCppyy::GetInstanceFreeListStats()
+{
+    return InstanceFreeListStats_t{gFreeListHits, gFreeListMisses, gFreeListSize};
+}
+
 
 namespace CPyCppyy {
 
@@ -393,8 +452,28 @@ static PyMethodDef op_methods[] = {
 //= CPyCppyy object proxy construction/destruction ===========================
 static CPPInstance* op_new(PyTypeObject* subtype, PyObject*, PyObject*)
 {
-// Create a new object proxy (holder only).
-    CPPInstance* pyobj = (CPPInstance*)subtype->tp_alloc(subtype, 0);
+// Create a new object proxy (holder only), re-using a recycled one if available.
+    CPPInstance* pyobj = nullptr;
+#ifdef CPYCPPYY_INSTANCE_FREELIST
+// only classes (heap types) carry a free list; proxies on it are untracked, zero
+// refcount, and hold no reference to their class
+    if ((subtype->tp_flags & Py_TPFLAGS_HEAPTYPE) && ((CPPClass*)subtype)->fFreeList) {
+        CPPClass* klass = (CPPClass*)subtype;
+        pyobj = (CPPInstance*)klass->fFreeList;
+        klass->fFreeList = (PyObject*)pyobj->fObject;
+        klass->fNFree -= 1;
+        gFreeListSize -= 1;
+        gFreeListHits += 1;
+
+        memset((char*)pyobj + sizeof(PyObject), 0, subtype->tp_basicsize - sizeof(PyObject));
+        (void)PyObject_INIT(pyobj, subtype);
+        PyObject_GC_Track((PyObject*)pyobj);
+    }
+#endif
+    if (!pyobj) {
+        pyobj = (CPPInstance*)subtype->tp_alloc(subtype, 0);
+        gFreeListMisses += 1;
+    }
     pyobj->fObject = nullptr;
     pyobj->fFlags = CPPInstance::kNoWrapConv;
 
@@ -404,9 +483,45 @@ static CPPInstance* op_new(PyTypeObject* subtype, PyObject*, PyObject*)
 //----------------------------------------------------------------------------
 static void op_dealloc(CPPInstance* pyobj)
 {
-// Remove (Python-side) memory held by the object proxy.
+// Remove (Python-side) memory held by the object proxy; plain proxies of C++ classes
+// are kept for re-use instead, up to a limit per class.
     PyObject_GC_UnTrack((PyObject*)pyobj);
+    bool isInline = pyobj->fFlags & CPPInstance::kIsInline;
     op_dealloc_nofree(pyobj);
+
+#ifdef CPYCPPYY_INSTANCE_FREELIST
+// the base part has been cleaned up already, by subtype_dealloc (which releases the
+// reference to the class on return), so only the proxy memory is left; proxies with
+// inline storage are larger, and python-side derived classes may carry more state;
+// proxies of classes with a finalizer (e.g. __del__ added from python) are marked as
+// finalized in their GC header, and would never be finalized again if re-used
+    PyTypeObject* pytype = Py_TYPE(pyobj);
+    if (!isInline && (pytype->tp_flags & Py_TPFLAGS_HEAPTYPE) && !pytype->tp_del
+#if PY_VERSION_HEX >= 0x03040000
+            && !pytype->tp_finalize
+#endif
+            ) {
+        CPPClass* klass = (CPPClass*)pytype;
+        if (!(klass->fFlags & CPPScope::kIsPython) && klass->fNFree < CPYCPPYY_INSTANCE_MAXFREELIST) {
+#if PY_VERSION_HEX >= 0x030B0000
+            if (pytype->tp_flags & Py_TPFLAGS_MANAGED_DICT) {
+            // reset the managed dict and values (p3.11) or weakref (p3.12) pointers ahead
+            // of the GC header, as they would be in a fresh allocation
+                ((PyObject**)pyobj)[-3] = nullptr;
+                ((PyObject**)pyobj)[-4] = nullptr;
+            }
+#endif
+            pyobj->fObject = (void*)klass->fFreeList;
+            klass->fFreeList = (PyObject*)pyobj;
+            klass->fNFree += 1;
+            gFreeListSize += 1;
+            return;
+        }
+    }
+#else
+    (void)isInline;
+#endif
+
     PyObject_GC_Del((PyObject*)pyobj);
 }
 
@@ -841,6 +956,12 @@ static PyObject* op_str(CPPInstance* self)
 //----------------------------------------------------------------------------
 static PyObject* op_getattro(PyObject* pyobj, PyObject* pyname)
 {
+// Members of lazily built classes are added on first access, then bound as usual;
+// this has to precede the generic lookup, or a base member could hide a pending one
+    CPPClass* klass = (CPPClass*)Py_TYPE(pyobj);
+    if ((PyTypeObject*)klass != &CPPInstance_Type && (klass->fFlags & CPPScope::kHasLazyBase))
+        ResolveLazyMember((PyObject*)klass, pyname);
+
 // Check if we can access the attribute at the object level
     PyObject* attr = PyObject_GenericGetAttr(pyobj, pyname);
     if (attr)
@@ -855,7 +976,6 @@ static PyObject* op_getattro(PyObject* pyobj, PyObject* pyname)
     PyErr_Fetch(&pytype, &pyvalue, &pytrace);
     
 // Perform a class level lookup for statics, enums etc.
-    CPPClass* klass = (CPPClass*)Py_TYPE(pyobj);
     attr = PyObject_GetAttr((PyObject*)klass, pyname);
     if (attr)
         return attr;
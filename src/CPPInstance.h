@@ -40,7 +40,8 @@ public:
         kNoMemReg    = 0x0400,
         kHasLifeLine = 0x0800,
         kIsRegulated = 0x1000,
-        kIsActual    = 0x2000 };
+        kIsActual    = 0x2000,
+        kIsInline    = 0x4000 };
 
 public:                 // public, as the python C-API works with C structs
     PyObject_HEAD
@@ -140,6 +141,16 @@ inline bool CPPInstance_CheckExact(T* object)
 //- helper for memory regulation (no PyTypeObject equiv. member in p2.2) -----
 void op_dealloc_nofree(CPPInstance*);
 
+//- recycling of instance proxies, per class ---------------------------------
+void ClearInstanceFreeList(CPPClass* klass);
+
+struct InstanceFreeListStats_t {
+    uint64_t fHits;          // proxies served from a free list
+    uint64_t fMisses;        // proxies newly allocated
+    size_t   fSize;          // proxies currently held in free lists
+};
+InstanceFreeListStats_t GetInstanceFreeListStats();
+
 } // namespace CPyCppyy
 
 #endif // !CPYCPPYY_CPPINSTANCE_H
@@ -3,6 +3,7 @@
 #include "CPPMethod.h"
 #include "CPPExcInstance.h"
 #include "CPPInstance.h"
+#include "CPPScope.h"
 #include "Converters.h"
 #include "Executors.h"
 #include "ProxyWrappers.h"
@@ -17,8 +18,10 @@
 #include <algorithm>
 #include <assert.h>
 #include <string.h>
+#include <chrono>
 #include <exception>
 #include <iostream>
+#include <set>
 #include <sstream>
 #include <string>
 #include <typeinfo>
@@ -93,18 +96,18 @@ inline void CPyCppyy::CPPMethod::Copy_(const CPPMethod& /* other */)
     fExecutor     = nullptr;
     fArgIndices   = nullptr;
     fArgsRequired = -1;
+    fGILState     = GILState_t{};
 }
 
 //----------------------------------------------------------------------------
 inline void CPyCppyy::CPPMethod::Destroy_()
 {
-// destroy executor and argument converters
-    if (fExecutor && fExecutor->HasState()) delete fExecutor;
+// release executor and argument converters (shared ones live on in the pools)
+    ReleaseExecutor(fExecutor);
     fExecutor = nullptr;
 
-    for (auto p : fConverters) {
-        if (p && p->HasState()) delete p;
-    }
+    for (auto p : fConverters)
+        ReleaseConverter(p);
     fConverters.clear();
 
     delete fArgIndices; fArgIndices = nullptr;
@@ -238,7 +241,7 @@ bool CPyCppyy::CPPMethod::InitConverters_()
 // setup the dispatch cache
     for (int iarg = 0; iarg < (int)nArgs; ++iarg) {
         Cppyy::TCppType_t fullType = Cppyy::GetMethodArgType(fMethod, iarg);
-        Converter* conv = CreateConverter(fullType);
+        Converter* conv = AcquireConverter(fullType);
         if (!conv) {
             PyErr_Format(PyExc_TypeError, "argument type %s not handled",
                 Cppyy::GetTypeAsString(fullType).c_str());
@@ -256,7 +259,7 @@ bool CPyCppyy::CPPMethod::InitExecutor_(Executor*& executor, CallContext* /* ctx
 {
 // install executor conform to the return type
     executor = 
-        (bool)fMethod == true ? CreateExecutor(Cppyy::GetMethodReturnType(fMethod)) \
+        (bool)fMethod == true ? AcquireExecutor(Cppyy::GetMethodReturnType(fMethod)) \
                               : CreateExecutor(Cppyy::GetScopedFinalName(fScope));
 
     if (!executor)
@@ -884,12 +887,123 @@ bool CPyCppyy::CPPMethod::ConvertAndSetArgs(CPyCppyy_PyArgs_t args, size_t nargs
     return isOK;
 }
 
+//----------------------------------------------------------------------------
+CPyCppyy::EMatch CPyCppyy::CPPMethod::MatchArgs(
+    CPyCppyy_PyArgs_t args, size_t nargsf, Py_ssize_t ifirst)
+{
+// estimate, without converting, how well the arguments from ifirst onwards match
+    if (fArgsRequired == -1)
+        return kMatchUnknown;              // converters not yet created
+
+    Py_ssize_t argc = CPyCppyy_PyArgs_GET_SIZE(args, nargsf) - ifirst;
+    if (argc < (Py_ssize_t)fArgsRequired || (Py_ssize_t)fConverters.size() < argc)
+        return kMatchImpossible;
+
+// the worst match decides, except that an argument that needs an implicit conversion
+// guarantees failure of the first stage only if all arguments before it can pass
+    EMatch result = kMatchExact;
+    for (Py_ssize_t i = 0; i < argc; ++i) {
+        EMatch m = fConverters[i]->CanConvert(CPyCppyy_PyArgs_GET_ITEM(args, ifirst+i));
+        if (m == kMatchImpossible)
+            return kMatchImpossible;
+        if (result < m && result != kMatchImplicit)
+            result = m;
+    }
+
+    return result;
+}
+
+//----------------------------------------------------------------------------
+bool CPyCppyy::CPPMethod::IsGILUnsafe_()
+{
+// the GIL can not be released automatically if C++ may use python objects (or call
+// back into python, through function pointers or std::function)
+    std::vector<std::string> types;
+    if ((bool)fMethod) {
+        types.push_back(Cppyy::GetMethodReturnTypeAsString(fMethod));
+        for (int iarg = 0; iarg < (int)Cppyy::GetMethodNumArgs(fMethod); ++iarg)
+            types.push_back(Cppyy::GetMethodArgTypeAsString(fMethod, iarg));
+    }
+
+// names are compared whole (a class such as my_object is fine), but anywhere in the
+// type, as python objects can also be passed in e.g. containers
+    static const std::set<std::string> sUnsafeNames = {
+        "PyObject", "_object", "PyTypeObject", "_typeobject", "PyVarObject", "std::function"};
+
+    for (const auto& type : types) {
+        const std::string& resolved = Cppyy::ResolveName(type);
+        if (resolved.find("(*)") != std::string::npos)
+            return true;
+
+        std::string::size_type pos = 0;
+        while (pos < resolved.size()) {
+            std::string::size_type end = pos;
+            while (end < resolved.size() && (isalnum((unsigned char)resolved[end]) || resolved[end] == '_' || \
+                    (resolved[end] == ':' && end+1 < resolved.size() && resolved[end+1] == ':'))) {
+                end += resolved[end] == ':' ? 2 : 1;
+            }
+            if (resolved.compare(pos, 2, "::") == 0)
+                pos += 2;      // globally qualified
+            if (pos < end && sUnsafeNames.count(resolved.substr(pos, end-pos)))
+                return true;
+            pos = end+1;
+        }
+    }
+
+    return false;
+}
+
+//----------------------------------------------------------------------------
+bool CPyCppyy::CPPMethod::AutoReleaseGIL_(CallContext* ctxt, bool& sample)
+{
+// decide whether to release the GIL per the policy for this method's scope; in the
+// adaptive case, the first calls are timed (with the GIL held) to decide on
+    const int kGILSamples = 8;
+
+    sample = false;
+    GILState_t& gs = fGILState;
+    if (gs.fGeneration != CallContext::sGILGeneration) {
+        gs = GILState_t{};
+        gs.fGeneration = CallContext::sGILGeneration;
+        gs.fPolicy = CallContext::GetGILPolicy(fScope);
+        gs.fUnsafe = gs.fPolicy != CallContext::kGILNever && IsGILUnsafe_();
+    }
+
+    if (gs.fPolicy == CallContext::kGILNever || gs.fUnsafe)
+        return false;
+
+// python-derived classes call back into python through their overrides
+    PyObject* pyctxt = ctxt->fPyContext;
+    if (pyctxt && CPPInstance_Check(pyctxt) && \
+            (((CPPClass*)Py_TYPE(pyctxt))->fFlags & CPPScope::kIsPython))
+        return false;
+
+    if (gs.fPolicy == CallContext::kGILAlways)
+        return true;
+
+    if (gs.fNSamples < kGILSamples) {
+        sample = true;
+        return false;
+    }
+
+    return gs.fRelease;
+}
+
 //----------------------------------------------------------------------------
 PyObject* CPyCppyy::CPPMethod::Execute(void* self, ptrdiff_t offset, CallContext* ctxt)
 {
 // call the interface method
     PyObject* result = 0;
 
+#ifdef WITH_THREAD
+// apply the GIL policy if the GIL is not explicitly released for this method
+    const uint32_t gilFlag = ctxt->fFlags & CallContext::kReleaseGIL;
+    bool sample = false;
+    if (!gilFlag && AutoReleaseGIL_(ctxt, sample))
+        ctxt->fFlags |= CallContext::kReleaseGIL;
+    const auto start = sample ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{};
+#endif
+
     if (CallContext::sSignalPolicy != CallContext::kProtected && \
         !(ctxt->fFlags & CallContext::kProtected)) {
     // bypasses try block (i.e. segfaults will abort)
@@ -899,6 +1013,16 @@ PyObject* CPyCppyy::CPPMethod::Execute(void* self, ptrdiff_t offset, CallContext
         result = ExecuteProtected(self, offset, ctxt);
     }
 
+#ifdef WITH_THREAD
+    if (sample && result) {
+        fGILState.fSampledNs += (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count();
+        fGILState.fNSamples += 1;
+        fGILState.fRelease = CallContext::sGILThreshold <= fGILState.fSampledNs / fGILState.fNSamples;
+    }
+    ctxt->fFlags = (ctxt->fFlags & ~CallContext::kReleaseGIL) | gilFlag;
+#endif
+
 // TODO: the following is dreadfully slow and dead-locks on Apache: revisit
 // raising exceptions through callbacks by using magic returns
 //    if (result && Utility::PyErr_Occurred_WithGIL()) {
@@ -965,6 +1089,33 @@ PyObject* CPyCppyy::CPPMethod::Call(CPPInstance*& self,
     return (PyObject*)pyobj;
 }
 
+//----------------------------------------------------------------------------
+CPyCppyy::EMatch CPyCppyy::CPPMethod::Match(CPPInstance* self,
+    CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds)
+{
+// only estimate if the arguments map directly onto the converters, i.e. no keywords
+    if (kwds)
+        return kMatchUnknown;
+
+    if (self)
+        return MatchArgs(args, nargsf);
+
+// unbound call: self is the first argument, see ProcessArgs(), except that the
+// (more expensive) subclass check is left to the actual call
+    if (!CPyCppyy_PyArgs_GET_SIZE(args, nargsf))
+        return kMatchImpossible;
+
+    CPPInstance* pyobj = (CPPInstance*)CPyCppyy_PyArgs_GET_ITEM(args, 0);
+    if (!CPPInstance_Check(pyobj))
+        return kMatchImpossible;
+
+    Cppyy::TCppType_t oisa = pyobj->ObjectIsA();
+    if (oisa == fScope || oisa == 0 || fScope == Cppyy::GetGlobalScope())
+        return MatchArgs(args, nargsf, 1);
+
+    return kMatchUnknown;
+}
+
 //- protected members --------------------------------------------------------
 PyObject* CPyCppyy::CPPMethod::GetSignature(bool fa)
 {
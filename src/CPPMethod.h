@@ -72,6 +72,21 @@ public:
 public:
     virtual PyObject* Call(CPPInstance*& self,
         CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds, CallContext* ctxt = nullptr);
+    virtual EMatch Match(CPPInstance* self, CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds);
+
+    Cppyy::TCppMethod_t GetMethod()   { return fMethod; }
+    Cppyy::TCppScope_t  GetScope()    { return fScope; }
+
+// automatic GIL release (see CallContext::EGILPolicy), for inspection
+    struct GILState_t {
+        uint64_t fGeneration = 0;       // of the policy the decision is based on
+        int      fPolicy     = -1;
+        bool     fUnsafe     = false;   // signature involves python objects or callbacks
+        bool     fRelease    = false;   // adaptive decision, once sampled
+        uint32_t fNSamples   = 0;
+        uint64_t fSampledNs  = 0;
+    };
+    const GILState_t& GetGILState() { return fGILState; }
 
 protected:
     virtual bool ProcessArgs(PyCallArgs& args);
@@ -79,10 +94,9 @@ protected:
     bool Initialize(CallContext* ctxt = nullptr);
     bool ProcessKwds(PyObject* self_in, PyCallArgs& args);
     bool ConvertAndSetArgs(CPyCppyy_PyArgs_t, size_t nargsf, CallContext* ctxt = nullptr);
+    EMatch MatchArgs(CPyCppyy_PyArgs_t, size_t nargsf, Py_ssize_t ifirst = 0);
     PyObject* Execute(void* self, ptrdiff_t offset, CallContext* ctxt = nullptr);
 
-    Cppyy::TCppMethod_t GetMethod()   { return fMethod; }
-    Cppyy::TCppScope_t  GetScope()    { return fScope; }
     Executor*           GetExecutor() { return fExecutor; }
     std::string         GetSignatureString(bool show_formalargs = true);
     std::string         GetReturnTypeName();
@@ -96,6 +110,8 @@ private:
 
     PyObject* ExecuteFast(void*, ptrdiff_t, CallContext*);
     PyObject* ExecuteProtected(void*, ptrdiff_t, CallContext*);
+    bool AutoReleaseGIL_(CallContext*, bool& sample);
+    bool IsGILUnsafe_();
 
     bool InitConverters_();
 
@@ -110,6 +126,7 @@ private:
 // call dispatch buffers
     std::vector<Converter*>     fConverters;
     std::map<std::string, int>* fArgIndices;
+    GILState_t                  fGILState;
 
 protected:
 // cached value that doubles as initialized flag (uninitialized if -1)
@@ -18,6 +18,10 @@ public:
     virtual PyCallable* Clone() { return new CPPOperator(*this); }
     virtual PyObject* Call(CPPInstance*& self,
         CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds, CallContext* ctxt = nullptr);
+    virtual EMatch Match(CPPInstance* self, CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds) {
+    // a failing method may still succeed through the global stub
+        return fStub ? kMatchUnknown : CPPMethod::Match(self, args, nargsf, kwds);
+    }
 
 private:
     binaryfunc fStub;
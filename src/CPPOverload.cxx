@@ -15,9 +15,11 @@
 #endif
 #include "CPPOverload.h"
 #include "CPPInstance.h"
+#include "CPPMethod.h"
 #include "CallContext.h"
 #include "PyStrings.h"
 #include "Utility.h"
+#include "VectorCall.h"
 
 // Standard
 #include <algorithm>
@@ -540,7 +542,77 @@ CPPYY_BOOLEAN_PROPERTY(lifeline, CallContext::kSetLifeLine, "__set_lifeline__")
 CPPYY_BOOLEAN_PROPERTY(threaded, CallContext::kReleaseGIL,  "__release_gil__")
 CPPYY_BOOLEAN_PROPERTY(useffi,   CallContext::kUseFFI,      "__useffi__")
 CPPYY_BOOLEAN_PROPERTY(sig2exc,  CallContext::kProtected,   "__sig2exc__")
+CPPYY_BOOLEAN_PROPERTY(nomemreg, CallContext::kNoMemReg,    "__no_memreg__")
 
+//----------------------------------------------------------------------------
+static PyObject* mp_getdispatchstats(CPPOverload* pymeth, void*)
+{
+// Get '__dispatch_stats__' dictionary, with the signature memoization counters.
+    auto& dispatchMap = pymeth->fMethodInfo->fDispatchMap;
+    const auto stats = dispatchMap.GetStats();
+    return Py_BuildValue("{s:K,s:K,s:K,s:K,s:K,s:K,s:n,s:n}",
+        "hits",         (unsigned long long)stats.fHits,
+        "misses",       (unsigned long long)stats.fMisses,
+        "collisions",   (unsigned long long)stats.fCollisions,
+        "replacements", (unsigned long long)stats.fReplacements,
+        "evictions",    (unsigned long long)stats.fEvictions,
+        "skips",        (unsigned long long)stats.fSkips,
+        "size",         (Py_ssize_t)dispatchMap.GetSize(),
+        "capacity",     (Py_ssize_t)dispatchMap.GetCapacity());
+}
+
+static int mp_setdispatchstats(CPPOverload* pymeth, PyObject* value, void*)
+{
+// Reset '__dispatch_stats__' counters on delete or assignment of None.
+    if (value && value != Py_None) {
+        PyErr_SetString(PyExc_TypeError, "__dispatch_stats__ can only be reset (del or None)");
+        return -1;
+    }
+
+    pymeth->fMethodInfo->fDispatchMap.ResetStats();
+    return 0;
+}
+
+//----------------------------------------------------------------------------
+static PyObject* mp_getgildecisions(CPPOverload* pymeth, void*)
+{
+// Get '__gil_decisions__' list, with the automatic GIL release state per overload.
+    static const char* sPolicies[] = {"default", "never", "always", "adaptive"};
+
+    auto& methods = pymeth->fMethodInfo->fMethods;
+    PyObject* decisions = PyList_New(0);
+    for (auto pc : methods) {
+        CPPMethod* m = dynamic_cast<CPPMethod*>(pc);
+        if (!m)
+            continue;
+
+        const CPPMethod::GILState_t& gs = m->GetGILState();
+        bool release = false;
+        if (gs.fGeneration == CallContext::sGILGeneration && !gs.fUnsafe) {
+            release = gs.fPolicy == CallContext::kGILAlways || \
+                (gs.fPolicy == CallContext::kGILAdaptive && gs.fRelease);
+        }
+
+        PyObject* sig = m->GetSignature();
+        PyObject* entry = Py_BuildValue("{s:N,s:s,s:O,s:O,s:I,s:d}",
+            "signature", sig,
+            "policy",    sPolicies[gs.fPolicy+1],
+            "unsafe",    gs.fUnsafe ? Py_True : Py_False,
+            "release",   release ? Py_True : Py_False,
+            "samples",   (unsigned int)gs.fNSamples,
+            "mean_us",   gs.fNSamples ? gs.fSampledNs/1000./gs.fNSamples : 0.);
+        if (!entry || PyList_Append(decisions, entry) != 0) {
+            Py_XDECREF(entry);
+            Py_DECREF(decisions);
+            return nullptr;
+        }
+        Py_DECREF(entry);
+    }
+
+    return decisions;
+}
+
+//----------------------------------------------------------------------------
 static PyObject* mp_getcppname(CPPOverload* pymeth, void*)
 {
     if ((void*)pymeth == (void*)&CPPOverload_Type)
@@ -586,15 +658,23 @@ static PyGetSetDef mp_getset[] = {
     {(char*)"__set_lifeline__",    (getter)mp_getlifeline, (setter)mp_setlifeline,
       (char*)"If true, set a lifeline from the return value onto self", nullptr},
     {(char*)"__release_gil__",     (getter)mp_getthreaded, (setter)mp_setthreaded,
-      (char*)"If true, releases GIL on call into C++", nullptr},
+      (char*)"If true, releases GIL on call into C++ (otherwise, the GIL policy applies)", nullptr},
+    {(char*)"__gil_decisions__",   (getter)mp_getgildecisions, nullptr,
+      (char*)"Automatic GIL release state per overload, as determined by the GIL policy", nullptr},
     {(char*)"__useffi__",          (getter)mp_getuseffi, (setter)mp_setuseffi,
       (char*)"not implemented", nullptr},
     {(char*)"__sig2exc__",         (getter)mp_getsig2exc, (setter)mp_setsig2exc,
       (char*)"If true, turn signals into Python exceptions", nullptr},
+    {(char*)"__no_memreg__",       (getter)mp_getnomemreg, (setter)mp_setnomemreg,
+      (char*)"If true, returned objects are not tracked for identity by the memory regulator", nullptr},
 
 // basic reflection information
     {(char*)"__cpp_name__",        (getter)mp_getcppname, nullptr, nullptr, nullptr},
 
+// dispatch memoization statistics
+    {(char*)"__dispatch_stats__",  (getter)mp_getdispatchstats, (setter)mp_setdispatchstats,
+      (char*)"Counters of the overload dispatch cache (hits, misses, skipped overloads, etc.)", nullptr},
+
     {(char*)nullptr, nullptr, nullptr, nullptr, nullptr}
 };
 
@@ -627,7 +707,7 @@ static PyObject* mp_call(CPPOverload* pymeth, PyObject* args, PyObject* kwds)
     const auto mempolicy = (mflags & (CallContext::kUseHeuristics | CallContext::kUseStrict));
     ctxt.fFlags |= mempolicy ? mempolicy : (uint64_t)CallContext::sMemoryPolicy;
     ctxt.fFlags |= (mflags & CallContext::kReleaseGIL);
-    ctxt.fFlags |= (mflags & CallContext::kProtected);
+    ctxt.fFlags |= (mflags & (CallContext::kProtected | CallContext::kNoMemReg));
     if (IsConstructor(pymeth->fMethodInfo->fFlags)) ctxt.fFlags |= CallContext::kIsConstructor;
     ctxt.fFlags |= (pymeth->fFlags & (CallContext::kCallDirect | CallContext::kFromDescr));
     ctxt.fPyContext = (PyObject*)im_self;  // no Py_INCREF as no ownership
@@ -642,17 +722,17 @@ static PyObject* mp_call(CPPOverload* pymeth, PyObject* args, PyObject* kwds)
         return HandleReturn(pymeth, im_self, result);
     }
 
-// otherwise, handle overloading
-    uint64_t sighash = HashSignature(args, nargsf);
-
-// look for known signatures ...
+// otherwise, handle overloading: look for known signatures ...
     auto& dispatchMap = pymeth->fMethodInfo->fDispatchMap;
+    std::vector<Utility::PyError_t> errors;
     PyCallable* memoized_pc = nullptr;
-    for (const auto& p : dispatchMap) {
-        if (p.first == sighash) {
-            memoized_pc = p.second;
-            break;
-        }
+    uint64_t known_rejected = 0, known_implicit = 0;
+    DispatchCache::Resolution_t memo;
+    if (dispatchMap.Find(args, nargsf, memo)) {
+    // copied out, as the cache may change during the call
+        memoized_pc    = memo.fCallable;
+        known_rejected = memo.fRejected;
+        known_implicit = memo.fImplicit;
     }
     if (memoized_pc) {
     // it is necessary to enable implicit conversions as the memoized call may be from
@@ -662,13 +742,25 @@ static PyObject* mp_call(CPPOverload* pymeth, PyObject* args, PyObject* kwds)
         if (result)
             return HandleReturn(pymeth, im_self, result);
 
-    // fall through: python is dynamic, and so, the hashing isn't infallible
-        ctxt.fFlags &= ~CallContext::kAllowImplicit;
-        PyErr_Clear();
+    // fall through: the signature matches exactly, but conversions can still fail
+    // on the argument values (e.g. an integer out of range for the memoized overload);
+    // the error is kept, as the overload is not called again below
+        ctxt.fFlags &= ~(CallContext::kAllowImplicit | CallContext::kHaveImplicit);
+        if (!PyErr_Occurred()) {
+            PyObject* sig = memoized_pc->GetPrototype();
+            PyErr_Format(PyExc_SystemError, "%s =>\n    %s",
+                CPyCppyy_PyText_AsString(sig), (char*)"nullptr result without error in overload call");
+            Py_DECREF(sig);
+        }
+        bool callee_error = ctxt.fFlags & (CallContext::kPyException | CallContext::kCppException);
+        ctxt.fFlags &= ~(CallContext::kPyException | CallContext::kCppException);
+        Utility::FetchError(errors, callee_error);
         ResetCallState(pymeth->fSelf, im_self);
     }
 
-// ... otherwise loop over all methods and find the one that does not fail
+// ... otherwise loop over all methods and find the one that does not fail; the
+// signature is taken before any call, as calls may change argument refcounts
+    const Signature_t sig = MakeSignature(args, nargsf);
     if (!IsSorted(mflags)) {
     // sorting is based on priority, which is not stored on the method as it is used
     // only once, so copy the vector of methods into one where the priority can be
@@ -682,71 +774,133 @@ static PyObject* mp_call(CPPOverload* pymeth, PyObject* args, PyObject* kwds)
         pymeth->fMethodInfo->fFlags |= CallContext::kIsSorted;
     }
 
-    std::vector<Utility::PyError_t> errors;
-    std::vector<bool> implicit_possible(methods.size());
-    for (int stage = 0; stage < 2; ++stage) {
-        bool bHaveImplicit = false;
+// overloads known to reject this signature are deferred, and those known to need
+// implicit conversions go straight to the second stage; if nothing else succeeds, the
+// deferred and skipped ones are tried after all, which also completes the error details
+// (what is learned is only kept if implicits are allowed, as the resolution is shared
+// with calls that are not); no overload is ever called twice in the same stage, as a
+// failed call may already have had side effects on the C++ side
+    const bool learn = !NoImplicit(&ctxt);
+    uint64_t deferred = known_rejected;
+    uint64_t implicit_only = learn ? known_implicit : 0;
+    enum { kRanExact = 0x01, kRanImplicit = 0x02 };
+    std::vector<char> ran(nMethods);
+    if (memoized_pc) {
         for (CPPOverload::Methods_t::size_type i = 0; i < nMethods; ++i) {
-            if (stage && !implicit_possible[i])
-                continue;    // did not set implicit conversion, so don't try again
-
-            PyObject* result = methods[i]->Call(im_self, args, nargsf, kwds, &ctxt);
-            if (result != 0) {
-            // success: update the dispatch map for subsequent calls
-                if (!memoized_pc)
-                    dispatchMap.push_back(std::make_pair(sighash, methods[i]));
-                else {
-                // debatable: apparently there are two methods that map onto the same sighash
-                // and preferring the latest may result in "ping pong."
-                    for (auto& p : dispatchMap) {
-                        if (p.first == sighash) {
-                            p.second = methods[i];
-                            break;
-                        }
+            if (methods[i] == memoized_pc) {
+                ran[i] = kRanExact | kRanImplicit;    // called with implicits allowed
+                break;
+            }
+        }
+    }
+    DispatchCache::Resolution_t res{nullptr, known_rejected, known_implicit};
+
+    std::vector<bool> implicit_possible(methods.size());
+    for (int pass = 0; pass < 2; ++pass) {
+        bool bSkipped = false;
+        for (int stage = 0; stage < 2; ++stage) {
+            bool bHaveImplicit = false;
+            for (CPPOverload::Methods_t::size_type i = 0; i < nMethods; ++i) {
+                if (stage && !implicit_possible[i])
+                    continue;    // did not set implicit conversion, so don't try again
+
+                if (ran[i] & (stage ? kRanImplicit : kRanExact))
+                    continue;    // already called (and failed) in this stage; error kept
+
+                const uint64_t mbit = DispatchCache::MethodBit(i);
+                if (!stage && ((deferred | implicit_only) & mbit)) {
+                    implicit_possible[i] = (bool)(implicit_only & mbit);
+                    bHaveImplicit = bHaveImplicit || implicit_possible[i];
+                    bSkipped = true;
+                    dispatchMap.RecordSkip();
+                    continue;
+                }
+
+            // ask the overload whether the arguments can convert at all, to save raising
+            // and clearing an exception where not (first pass only, as the retry is for
+            // collecting the complete error details); an overload that is skipped here
+            // has not been called, so calling it on the retry does not repeat anything
+                if (!stage && !pass) {
+                    EMatch match = methods[i]->Match(im_self, args, nargsf, kwds);
+                    if (match == kMatchImplicit && NoImplicit(&ctxt))
+                        match = kMatchImpossible;
+                    if (match == kMatchImpossible || match == kMatchImplicit) {
+                        implicit_possible[i] = match == kMatchImplicit;
+                        bHaveImplicit = bHaveImplicit || implicit_possible[i];
+                        bSkipped = true;
+                        dispatchMap.RecordSkip();
+                        continue;
                     }
                 }
 
-            // clear collected errors
-                if (!errors.empty())
-                    std::for_each(errors.begin(), errors.end(), Utility::PyError_t::Clear);
-                return HandleReturn(pymeth, im_self, result);
-            }
+                ran[i] |= stage ? kRanImplicit : kRanExact;
+                PyObject* result = methods[i]->Call(im_self, args, nargsf, kwds, &ctxt);
+                if (result != 0) {
+                // success: update the dispatch map for subsequent calls
+                    res.fCallable = methods[i];
+                    res.fRejected &= ~mbit;
+                    if (!stage) res.fImplicit &= ~mbit;
+                    dispatchMap.Insert(sig, res);
+
+                // clear collected errors
+                    if (!errors.empty())
+                        std::for_each(errors.begin(), errors.end(), Utility::PyError_t::Clear);
+                    return HandleReturn(pymeth, im_self, result);
+                }
 
-        // else failure ..
-            if (stage != 0) {
-                PyErr_Clear();    // first stage errors should be the more informative
-                ResetCallState(pymeth->fSelf, im_self);
-                continue;
-            }
+            // else failure ..
+                if (stage != 0) {
+                    PyErr_Clear();    // first stage errors should be the more informative
+                    ResetCallState(pymeth->fSelf, im_self);
+                    continue;
+                }
 
-        // collect error message/trace (automatically clears exception, too)
-            if (!PyErr_Occurred()) {
-            // this should not happen; set an error to prevent core dump and report
-                PyObject* sig = methods[i]->GetPrototype();
-                PyErr_Format(PyExc_SystemError, "%s =>\n    %s",
-                    CPyCppyy_PyText_AsString(sig), (char*)"nullptr result without error in overload call");
-                Py_DECREF(sig);
+            // collect error message/trace (automatically clears exception, too)
+                if (!PyErr_Occurred()) {
+                // this should not happen; set an error to prevent core dump and report
+                    PyObject* sig = methods[i]->GetPrototype();
+                    PyErr_Format(PyExc_SystemError, "%s =>\n    %s",
+                        CPyCppyy_PyText_AsString(sig), (char*)"nullptr result without error in overload call");
+                    Py_DECREF(sig);
+                }
+
+            // retrieve, store, and clear errors
+                bool callee_error = ctxt.fFlags & (CallContext::kPyException | CallContext::kCppException);
+                ctxt.fFlags &= ~(CallContext::kPyException | CallContext::kCppException);
+                Utility::FetchError(errors, callee_error);
+
+                if (HaveImplicit(&ctxt)) {
+                    bHaveImplicit = true;
+                    implicit_possible[i] = true;
+                    ctxt.fFlags &= ~CallContext::kHaveImplicit;
+                    res.fImplicit |= mbit;
+                    res.fRejected &= ~mbit;
+                } else {
+                    implicit_possible[i] = false;
+                    if (learn) {
+                    // an exception from the callee itself says nothing about the conversions
+                        if (!callee_error) res.fRejected |= mbit;
+                        else res.fRejected &= ~mbit;
+                        res.fImplicit &= ~mbit;
+                    }
+                }
+                ResetCallState(pymeth->fSelf, im_self);
             }
 
-        // retrieve, store, and clear errors
-            bool callee_error = ctxt.fFlags & (CallContext::kPyException | CallContext::kCppException);
-            ctxt.fFlags &= ~(CallContext::kPyException | CallContext::kCppException);
-            Utility::FetchError(errors, callee_error);
+        // only move forward if implicit conversions are available
+            if (!bHaveImplicit)
+                break;
 
-            if (HaveImplicit(&ctxt)) {
-                bHaveImplicit = true;
-                implicit_possible[i] = true;
-                ctxt.fFlags &= ~CallContext::kHaveImplicit;
-            } else
-                implicit_possible[i] = false;
-            ResetCallState(pymeth->fSelf, im_self);
+            ctxt.fFlags |= CallContext::kAllowImplicit;
         }
 
-    // only move forward if implicit conversions are available
-        if (!bHaveImplicit)
+    // if nothing was skipped, all overloads have been tried and the errors are complete;
+    // otherwise, call only those that were skipped, adding to the errors collected
+        if (!bSkipped)
             break;
 
-        ctxt.fFlags |= CallContext::kAllowImplicit;
+        ctxt.fFlags &= ~CallContext::kAllowImplicit;
+        deferred = implicit_only = 0;
     }
 
 // first summarize, then add details
@@ -952,6 +1106,12 @@ static PyObject* mp_reflex(CPPOverload* pymeth, PyObject* args)
     return pymeth->fMethodInfo->fMethods[0]->Reflex(request, format);
 }
 
+static PyObject* mp_vectorize(CPPOverload* pymeth, PyObject* args, PyObject* kwds)
+{
+// Call element-wise over buffers of builtin scalars, resolving the overload only once.
+    return VectorizedCall(pymeth, args, kwds);
+}
+
 //----------------------------------------------------------------------------
 static PyMethodDef mp_methods[] = {
     {(char*)"__overload__",     (PyCFunction)mp_overload, METH_VARARGS,
@@ -960,6 +1120,8 @@ static PyMethodDef mp_methods[] = {
       (char*)"add a new overload" },
     {(char*)"__cpp_reflex__",   (PyCFunction)mp_reflex, METH_VARARGS,
       (char*)"C++ overload reflection information" },
+    {(char*)"__vectorize__",    (PyCFunction)mp_vectorize, METH_VARARGS | METH_KEYWORDS,
+      (char*)"element-wise call over buffers: f.__vectorize__(*args, out=None, release_gil=False)" },
     {(char*)nullptr, nullptr, 0, nullptr }
 };
 
@@ -1046,6 +1208,7 @@ void CPyCppyy::CPPOverload::Set(const std::string& name, std::vector<PyCallable*
     fMethodInfo->fName = name;
     fMethodInfo->fMethods.swap(methods);
     fMethodInfo->fFlags &= ~CallContext::kIsSorted;
+    fMethodInfo->fDispatchMap.Clear();
 
 // special case: all constructors are considered creators by default
     if (name == "__init__")
@@ -1067,6 +1230,7 @@ void CPyCppyy::CPPOverload::AdoptMethod(PyCallable* pc)
 // Fill in the data of a freshly created method proxy.
     fMethodInfo->fMethods.push_back(pc);
     fMethodInfo->fFlags &= ~CallContext::kIsSorted;
+    fMethodInfo->fDispatchMap.Clear();     // resolutions refer to the sorted overloads
 }
 
 //----------------------------------------------------------------------------
@@ -1077,7 +1241,8 @@ void CPyCppyy::CPPOverload::MergeOverload(CPPOverload* meth)
     fMethodInfo->fMethods.insert(fMethodInfo->fMethods.end(),
         meth->fMethodInfo->fMethods.begin(), meth->fMethodInfo->fMethods.end());
     fMethodInfo->fFlags &= ~CallContext::kIsSorted;
-    meth->fMethodInfo->fDispatchMap.clear();
+    fMethodInfo->fDispatchMap.Clear();     // resolutions refer to the sorted overloads
+    meth->fMethodInfo->fDispatchMap.Clear();
     meth->fMethodInfo->fMethods.clear();
 }
 
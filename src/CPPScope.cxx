@@ -4,6 +4,7 @@
 #include "CPPDataMember.h"
 #include "CPPEnum.h"
 #include "CPPFunction.h"
+#include "CPPInstance.h"
 #include "CPPOverload.h"
 #include "CustomPyTypes.h"
 #include "Dispatcher.h"
@@ -79,10 +80,14 @@ static void meta_dealloc(CPPScope* scope)
             for (auto pyobj : *scope->fImp.fUsing) Py_DECREF(pyobj);
             delete scope->fImp.fUsing; scope->fImp.fUsing = nullptr;
         }
-    } else if (!(scope->fFlags & CPPScope::kIsPython)) {
-        delete scope->fImp.fCppObjects; scope->fImp.fCppObjects = nullptr;
+    } else {
+        if (!(scope->fFlags & CPPScope::kIsPython)) {
+            delete scope->fImp.fCppObjects; scope->fImp.fCppObjects = nullptr;
+        }
+        ClearInstanceFreeList(scope);
     }
     delete scope->fOperators;
+    delete scope->fLazyMembers;
     free(scope->fModuleName);
     return PyType_Type.tp_dealloc((PyObject*)scope);
 }
@@ -158,6 +163,38 @@ static int meta_setmodule(CPPScope* scope, PyObject* value, void*)
     return 0;
 }
 
+//-----------------------------------------------------------------------------
+static PyObject* meta_getmemreg(CPPScope* scope, void*)
+{
+    if ((void*)scope == (void*)&CPPInstance_Type)
+        Py_RETURN_TRUE;
+
+    return PyBool_FromLong(!(scope->fFlags & CPPScope::kNoMemReg));
+}
+
+//-----------------------------------------------------------------------------
+static int meta_setmemreg(CPPScope* scope, PyObject* value, void*)
+{
+// Identity tracking of bound objects of this class; if off, the memory regulator is
+// by-passed, and the same C++ object may be represented by several proxies.
+    if ((void*)scope == (void*)&CPPInstance_Type) {
+        PyErr_SetString(PyExc_AttributeError,
+            "attribute \'__memreg__\' of 'cppyy.CPPScope\' objects is not writable");
+        return -1;
+    }
+
+    int istrue = value ? PyObject_IsTrue(value) : 1;     // delete restores the default
+    if (istrue == -1)
+        return -1;
+
+    if (istrue)
+        scope->fFlags &= ~CPPScope::kNoMemReg;
+    else
+        scope->fFlags |= CPPScope::kNoMemReg;
+
+    return 0;
+}
+
 //----------------------------------------------------------------------------
 static PyObject* meta_repr(CPPScope* scope)
 {
@@ -216,7 +253,10 @@ static PyObject* pt_new(PyTypeObject* subtype, PyObject* args, PyObject* kwds)
 
     result->fFlags      = CPPScope::kNone;
     result->fOperators  = nullptr;
+    result->fLazyMembers = nullptr;
     result->fModuleName = nullptr;
+    result->fFreeList   = nullptr;
+    result->fNFree      = 0;
 
     if (raw && deref) {
         result->fFlags |= CPPScope::kIsSmart;
@@ -249,6 +289,10 @@ static PyObject* pt_new(PyTypeObject* subtype, PyObject* args, PyObject* kwds)
                 result->fFlags |= CPPScope::kIsPython;
                 if (1 < PyTuple_GET_SIZE(PyTuple_GET_ITEM(args, 1)))
                     result->fFlags |= CPPScope::kIsMultiCross;
+            // C++ members still to be built would otherwise be shadowed by python ones
+                PyObject* bases = PyTuple_GET_ITEM(args, 1);
+                for (Py_ssize_t ibase = 0; ibase < PyTuple_GET_SIZE(bases); ++ibase)
+                    BuildLazyMembers(PyTuple_GET_ITEM(bases, ibase));
                 std::ostringstream errmsg;
                 if (!InsertDispatcher(result, PyTuple_GET_ITEM(args, 1), dct, errmsg)) {
                     PyErr_Format(PyExc_TypeError, "no python-side overrides supported (%s)", errmsg.str().c_str());
@@ -305,6 +349,12 @@ static PyObject* pt_new(PyTypeObject* subtype, PyObject* args, PyObject* kwds)
 //----------------------------------------------------------------------------
 static PyObject* meta_getattro(PyObject* pyclass, PyObject* pyname)
 {
+// members of lazily built classes are added to their dictionaries on first access,
+// ahead of the lookup, as a base member could otherwise hide a pending one
+    if (pyclass != (PyObject*)&CPPInstance_Type && CPPScope_Check(pyclass) && \
+            (((CPPScope*)pyclass)->fFlags & CPPScope::kHasLazyBase))
+        ResolveLazyMember(pyclass, pyname);
+
 // normal type-based lookup
     PyObject* attr = PyType_Type.tp_getattro(pyclass, pyname);
     if (pyclass == (PyObject*)&CPPInstance_Type)
@@ -594,12 +644,24 @@ static PyObject* meta_dir(CPPScope* klass)
     }
 
     PyObject* dirlist = _generic_dir((PyObject*)klass);
-    if (!(klass->fFlags & CPPScope::kIsNamespace))
+    if (!(klass->fFlags & (CPPScope::kIsNamespace | CPPScope::kIsLazy)))
         return dirlist;
 
     std::set<std::string> cppnames;
     Cppyy::GetAllCppNames(klass->fCppType, cppnames);
 
+// members still pending on (lazily built) bases
+    PyObject* mro = ((PyTypeObject*)klass)->tp_mro;
+    for (Py_ssize_t ibase = 0; mro && ibase < PyTuple_GET_SIZE(mro); ++ibase) {
+        PyObject* base = PyTuple_GET_ITEM(mro, ibase);
+        if (base == (PyObject*)&CPPInstance_Type || !CPPScope_Check(base) || \
+                !((CPPScope*)base)->fLazyMembers)
+            continue;
+        LazyMembers_t* lazy = ((CPPScope*)base)->fLazyMembers;
+        for (const auto& lm : lazy->fMethods)     cppnames.insert(lm.first);
+        for (const auto& ld : lazy->fDataMembers) cppnames.insert(ld.first);
+    }
+
 // cleanup names
     std::set<std::string> dir_cppnames;
     for (const std::string& name : cppnames) {
@@ -637,6 +699,8 @@ static PyMethodDef meta_methods[] = {
 static PyGetSetDef meta_getset[] = {
     {(char*)"__cpp_name__", (getter)meta_getcppname, nullptr, nullptr, nullptr},
     {(char*)"__module__",   (getter)meta_getmodule,  (setter)meta_setmodule, nullptr, nullptr},
+    {(char*)"__memreg__",   (getter)meta_getmemreg,  (setter)meta_setmemreg,
+      (char*)"If false, bound objects of this class are not tracked for identity", nullptr},
     {(char*)nullptr, nullptr, nullptr, nullptr, nullptr}
 };
 
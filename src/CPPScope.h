@@ -18,8 +18,13 @@ typedef struct {
 
 #endif
 
+// Bindings
+#include "CppToPyMap.h"
+
 // Standard
 #include <map>
+#include <string>
+#include <vector>
 
 
 namespace CPyCppyy {
@@ -31,9 +36,15 @@ namespace CPyCppyy {
       @version 2.0
  */
 
-typedef std::map<Cppyy::TCppObject_t, PyObject*> CppToPyMap_t;
 namespace Utility { struct PyOperators; }
 
+// members of a lazily built class that have not been added to its dictionary yet,
+// by python name (see kIsLazy)
+struct LazyMembers_t {
+    std::map<std::string, std::vector<Cppyy::TCppMethod_t>> fMethods;
+    std::map<std::string, Cppyy::TCppScope_t>               fDataMembers;
+};
+
 class CPPScope {
 public:
     enum EFlags {
@@ -48,7 +59,10 @@ public:
         kNoImplicit      = 0x0080,
         kNoOSInsertion   = 0x0100,
         kGblOSInsertion  = 0x0200,
-        kNoPrettyPrint   = 0x0400 };
+        kNoPrettyPrint   = 0x0400,
+        kIsLazy          = 0x0800,
+        kNoMemReg        = 0x1000,
+        kHasLazyBase     = 0x2000 };
 
 public:
     PyHeapTypeObject   fType;
@@ -59,7 +73,10 @@ public:
         std::vector<PyObject*>* fUsing;          // namespaces only
     } fImp;
     Utility::PyOperators*       fOperators;
+    LazyMembers_t*              fLazyMembers;    // lazily built classes only
     char*             fModuleName;
+    PyObject*         fFreeList;       // recycled instance proxies (classes only)
+    uint32_t          fNFree;
 
 private:
     CPPScope() = delete;
@@ -105,7 +122,10 @@ inline CPPScope* CPPScopeMeta_New(Cppyy::TCppScope_t klass, PyObject* args)
     pymeta->fFlags           = CPPScope::kIsMeta;
     pymeta->fImp.fCppObjects = nullptr;
     pymeta->fOperators       = nullptr;
+    pymeta->fLazyMembers     = nullptr;
     pymeta->fModuleName      = nullptr;
+    pymeta->fFreeList        = nullptr;
+    pymeta->fNFree           = 0;
 
     return pymeta;
 }
@@ -8,16 +8,20 @@
 #include "CPPOverload.h"
 #include "CPPScope.h"
 #include "CustomPyTypes.h"
+#include "Executors.h"
 #include "LowLevelViews.h"
 #include "MemoryRegulator.h"
 #include "ProxyWrappers.h"
 #include "PyStrings.h"
+#include "ReflectionCache.h"
 #include "TemplateProxy.h"
+#include "Threading.h"
 #include "TupleOfInstances.h"
 #include "Utility.h"
 
 #define CPYCPPYY_INTERNAL 1
 #include "CPyCppyy/DispatchPtr.h"
+#include "CPyCppyy/PyException.h"
 namespace CPyCppyy {
 void* Instance_AsVoidPtr(PyObject* pyobject);
 PyObject* Instance_FromVoidPtr(
@@ -27,6 +31,7 @@ PyObject* Instance_FromVoidPtr(
 
 // Standard
 #include <algorithm>
+#include <chrono>
 #include <map>
 #include <set>
 #include <string>
@@ -194,6 +199,53 @@ static PyTypeObject PyDefault_t_Type = {
 #endif
 };
 
+
+static PyObject* nomemreg_enter(PyObject* self, PyObject*)
+{
+    CPyCppyy::MemoryRegulator::BeginBypass();
+    Py_INCREF(self);
+    return self;
+}
+
+static PyObject* nomemreg_exit(PyObject*, PyObject*)
+{
+    CPyCppyy::MemoryRegulator::EndBypass();
+    Py_RETURN_FALSE;
+}
+
+static PyMethodDef nomemreg_methods[] = {
+    {(char*)"__enter__", (PyCFunction)nomemreg_enter, METH_NOARGS, nullptr},
+    {(char*)"__exit__",  (PyCFunction)nomemreg_exit,  METH_VARARGS, nullptr},
+    {(char*)nullptr, nullptr, 0, nullptr}
+};
+
+// context manager that switches off object identity tracking for the current thread
+// (see MemoryRegulator::IsBypassed); scopes nest
+static PyTypeObject PyNoMemReg_Type = {
+    PyVarObject_HEAD_INIT(&PyType_Type, 0)
+    "no_memreg",         // tp_name
+    sizeof(PyObject),    // tp_basicsize
+    0,                   // tp_itemsize
+    0,                   // tp_dealloc
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    Py_TPFLAGS_DEFAULT,  // tp_flags
+    (char*)"Bind C++ objects without identity tracking, within a with-block", // tp_doc
+    0, 0, 0, 0, 0, 0,
+    nomemreg_methods,    // tp_methods
+    0, 0, 0, 0, 0, 0, 0, 0, 0,
+    PyType_GenericNew,   // tp_new
+    0, 0, 0, 0, 0, 0, 0
+#if PY_VERSION_HEX >= 0x02030000
+    , 0                  // tp_del
+#endif
+#if PY_VERSION_HEX >= 0x02060000
+    , 0                  // tp_version_tag
+#endif
+#if PY_VERSION_HEX >= 0x03040000
+    , 0                  // tp_finalize
+#endif
+};
+
 namespace {
 
 PyObject _CPyCppyy_NullPtrStruct = {
@@ -228,6 +280,7 @@ namespace CPyCppyy {
     std::set<Cppyy::TCppScope_t> gPinnedTypes;
     std::ostringstream gCapturedError;
     std::streambuf* gOldErrorBuffer = nullptr;
+    RecursiveMutex gBindingsLock;
 }
 
 
@@ -755,6 +808,53 @@ static PyObject* BindObject(PyObject*, PyObject* args, PyObject* kwds)
     return BindCppObjectNoCast(addr, cast_type);
 }
 
+//----------------------------------------------------------------------------
+static PyObject* BindArray(PyObject*, PyObject* args)
+{
+// From an address (as for bind_object), bind a C-style array of objects of the given
+// class as a single sequence view; its elements are proxied on access, without identity
+// tracking. The address argument, if not a plain integer, is kept alive by the view.
+    PyObject* pyaddr = nullptr; PyObject* pyclass = nullptr; Py_ssize_t size = 0;
+    if (!PyArg_ParseTuple(args, const_cast<char*>("OO!n:bind_array"),
+            &pyaddr, &CPPScope_Type, &pyclass, &size))
+        return nullptr;
+
+    if (size < 0) {
+        PyErr_SetString(PyExc_ValueError, "bind_array requires a non-negative size");
+        return nullptr;
+    }
+
+    void* addr = nullptr;
+    if (CPPInstance_Check(pyaddr))
+        addr = ((CPPInstance*)pyaddr)->GetObject();
+    else if (pyaddr != &_CPyCppyy_NullPtrStruct) {
+        addr = CPyCppyy_PyCapsule_GetPointer(pyaddr, nullptr);
+        if (PyErr_Occurred()) {
+            PyErr_Clear();
+
+            addr = PyLong_AsVoidPtr(pyaddr);
+            if (PyErr_Occurred()) {
+                PyErr_Clear();
+
+                Py_ssize_t buflen = Utility::GetBuffer(pyaddr, '*', 1, addr, false);
+                if (!addr || !buflen) {
+                    PyErr_SetString(PyExc_TypeError,
+                        "bind_array requires a CObject/Capsule, long integer, buffer, or instance as first argument");
+                    return nullptr;
+                }
+            }
+        }
+    }
+
+    if (!addr && size) {
+        PyErr_SetString(PyExc_ReferenceError, "attempt to bind an array at a null address");
+        return nullptr;
+    }
+
+    PyObject* owner = PyLong_Check(pyaddr) ? nullptr : pyaddr;
+    return InstanceArrayView_New(addr, ((CPPClass*)pyclass)->fCppType, size, owner);
+}
+
 //----------------------------------------------------------------------------
 static PyObject* Move(PyObject*, PyObject* pyobject)
 {
@@ -875,6 +975,51 @@ static PyObject* SetGlobalSignalPolicy(PyObject*, PyObject* args)
     Py_RETURN_FALSE;
 }
 
+//----------------------------------------------------------------------------
+static PyObject* SetGILPolicy(PyObject*, PyObject* args)
+{
+// Set the GIL release policy, globally or (if given) for a scope and its nested
+// scopes, for methods that are not explicitly flagged with __release_gil__.
+    int policy = 0;
+    PyObject* pyscope = nullptr;
+    if (!PyArg_ParseTuple(args, const_cast<char*>("i|O"), &policy, &pyscope))
+        return nullptr;
+
+    Cppyy::TCppScope_t scope = 0;
+    if (pyscope && pyscope != Py_None) {
+        if (!CPPScope_Check(pyscope)) {
+            PyErr_SetString(PyExc_TypeError, "scope must be a C++ class or namespace");
+            return nullptr;
+        }
+        scope = ((CPPScope*)pyscope)->fCppType;
+    }
+
+    if (CallContext::SetGILPolicy(policy, scope)) {
+        Py_RETURN_NONE;
+    }
+
+    PyErr_Format(PyExc_ValueError, "Unknown GIL policy %d", policy);
+    return nullptr;
+}
+
+//----------------------------------------------------------------------------
+static PyObject* SetGILThreshold(PyObject*, PyObject* args)
+{
+// Set the C++ execution time (in microseconds) above which methods release the GIL
+// under the adaptive policy; returns the previous value.
+    double us = 0.;
+    if (!PyArg_ParseTuple(args, const_cast<char*>("d"), &us))
+        return nullptr;
+
+    if (us < 0.) {
+        PyErr_SetString(PyExc_ValueError, "threshold must be non-negative");
+        return nullptr;
+    }
+
+    uint64_t old = CallContext::SetGILThreshold((uint64_t)(us*1000.));
+    return PyFloat_FromDouble(old/1000.);
+}
+
 //----------------------------------------------------------------------------
 static PyObject* SetOwnership(PyObject*, PyObject* args)
 {
@@ -925,6 +1070,187 @@ static PyObject* EndCaptureStderr(PyObject*, PyObject*)
 
     return Py_BuildValue("s", capturedError.c_str());
 }
+
+//----------------------------------------------------------------------------
+static PyObject* SetReflectionCache(PyObject*, PyObject* args)
+{
+// Use a persistent cache for the reflection data that class proxies are built from;
+// the fingerprint should identify the headers and libraries loaded (None disables).
+    PyObject* pypath = nullptr; const char* fingerprint = nullptr;
+    if (!PyArg_ParseTuple(args, const_cast<char*>("O|s:_set_reflection_cache"), &pypath, &fingerprint))
+        return nullptr;
+
+    if (pypath == Py_None) {
+        ReflectionCache::Close();
+        Py_RETURN_FALSE;
+    }
+
+    const char* path = CPyCppyy_PyText_AsString(pypath);
+    if (!path)
+        return nullptr;
+
+    if (!fingerprint) {
+        PyErr_SetString(PyExc_TypeError, "_set_reflection_cache() requires a fingerprint");
+        return nullptr;
+    }
+
+    if (ReflectionCache::Open(path, fingerprint))
+        Py_RETURN_TRUE;
+    Py_RETURN_FALSE;
+}
+
+//----------------------------------------------------------------------------
+static PyObject* SetLazyClassBuild(PyObject*, PyObject* args)
+{
+// Select whether class proxies created from here on add their methods and data
+// members on first access, rather than all at once.
+    PyObject* setLazy = nullptr;
+    if (!PyArg_ParseTuple(args, const_cast<char*>("O:_set_lazy_class_build"), &setLazy))
+        return nullptr;
+
+    int lazy = PyObject_IsTrue(setLazy);
+    if (lazy < 0)
+        return nullptr;
+    CPyCppyy::SetLazyClassBuild((bool)lazy);
+
+    Py_RETURN_NONE;
+}
+
+//----------------------------------------------------------------------------
+static PyObject* BenchCallback(PyObject*, PyObject* args, PyObject* kwds)
+{
+// Microbenchmark of the round-trip cost of calling back into python from C++: the
+// callable is converted to a double(*)(double) function pointer, as when passed to a
+// C++ function taking one, which is then called ncalls times, with the GIL held by
+// the calling thread or (with release_gil) not.
+    PyObject* pycallable = nullptr; Py_ssize_t ncalls = 100000; int releaseGIL = 0;
+    static const char* kwlist[] = {"callable", "ncalls", "release_gil", nullptr};
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, const_cast<char*>("O|np:_bench_callback"),
+            (char**)kwlist, &pycallable, &ncalls, &releaseGIL))
+        return nullptr;
+
+    typedef double (*callback_t)(double);
+    callback_t fptr = nullptr;
+    Converter* conv = CreateConverter("double(*)(double)");
+    bool ok = conv && conv->ToMemory(pycallable, (void*)&fptr, nullptr);
+    DestroyConverter(conv);
+    if (!ok || !fptr) {
+        if (!PyErr_Occurred())
+            PyErr_SetString(PyExc_TypeError, "callable can not be used as a double(*)(double)");
+        return nullptr;
+    }
+
+    double total = 0.;
+    bool failed = false;
+    auto start = std::chrono::steady_clock::now();
+    PyThreadState* state = releaseGIL ? PyEval_SaveThread() : nullptr;
+    try {
+        for (Py_ssize_t i = 0; i < ncalls; ++i)
+            total += fptr((double)i);
+    } catch (PyException&) {
+        failed = true;           // python error is set
+    }
+    if (state) PyEval_RestoreThread(state);
+    auto stop = std::chrono::steady_clock::now();
+
+    if (failed)
+        return nullptr;
+
+    double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(stop-start).count();
+    return Py_BuildValue("{s:n,s:d,s:d}",
+        "calls", ncalls, "ns_per_call", ncalls ? ns/ncalls : 0., "total", total);
+}
+
+//----------------------------------------------------------------------------
+static PyObject* GetPoolStats(PyObject*, PyObject*)
+{
+// report use of the shared converter and executor pools; each reference beyond the
+// first to a shared instance is an instance that would otherwise have been allocated
+    ConverterPoolStats_t cs = GetConverterPoolStats();
+    ExecutorPoolStats_t  es = GetExecutorPoolStats();
+    return Py_BuildValue("{s:{s:n,s:n,s:K},s:{s:n,s:n,s:K}}",
+        "converters", "instances", (Py_ssize_t)cs.fInstances,
+                      "references", (Py_ssize_t)cs.fReferences,
+                      "hits", (unsigned long long)cs.fHits,
+        "executors",  "instances", (Py_ssize_t)es.fInstances,
+                      "references", (Py_ssize_t)es.fReferences,
+                      "hits", (unsigned long long)es.fHits);
+}
+
+//----------------------------------------------------------------------------
+static PyObject* GetCallArenaStats(PyObject*, PyObject*)
+{
+// report use of the per-thread scratch memory of calls; heap allocations are only
+// needed to grow the arena, so should stay flat once warmed up
+    CallArena& arena = CallArena::Get();
+    size_t bytes = 0;
+    for (const auto& b : arena.fBlocks)
+        bytes += b.fSize;
+    return Py_BuildValue("{s:K,s:K,s:K,s:n}",
+        "calls", (unsigned long long)arena.fNCalls,
+        "heap_allocs", (unsigned long long)arena.fNHeapAllocs,
+        "last_call_heap_allocs", (unsigned long long)arena.fLastHeapAllocs,
+        "arena_bytes", (Py_ssize_t)bytes);
+}
+
+//----------------------------------------------------------------------------
+static PyObject* GetFreeListStats(PyObject*, PyObject* args)
+{
+// report recycling of instance proxies; the size is either the total, or that for
+// the given class
+    PyObject* pyclass = nullptr;
+    if (!PyArg_ParseTuple(args, const_cast<char*>("|O!:_proxy_freelist_stats"), &CPPScope_Type, &pyclass))
+        return nullptr;
+
+    InstanceFreeListStats_t fs = GetInstanceFreeListStats();
+    size_t size = fs.fSize;
+    if (pyclass) {
+    // the CPPInstance base type is not a heap type and carries no list
+        bool isHeapType = ((PyTypeObject*)pyclass)->tp_flags & Py_TPFLAGS_HEAPTYPE;
+        size = isHeapType ? ((CPPScope*)pyclass)->fNFree : 0;
+    }
+    return Py_BuildValue("{s:K,s:K,s:n}",
+        "hits", (unsigned long long)fs.fHits,
+        "misses", (unsigned long long)fs.fMisses,
+        "size", (Py_ssize_t)size);
+}
+
+//----------------------------------------------------------------------------
+static PyObject* GetMemRegStats(PyObject*, PyObject* args)
+{
+// report use of the object identity tracking tables; the mean probe length is the
+// ratio of probes over lookups, which should stay flat as the number of live objects
+// grows; with a class, its table's size and capacity are added
+    PyObject* pyclass = nullptr;
+    if (!PyArg_ParseTuple(args, const_cast<char*>("|O!:_memreg_stats"), &CPPScope_Type, &pyclass))
+        return nullptr;
+
+    CppToPyMap_t::Stats_t ms = CppToPyMap_t::GetTotalStats();
+    PyObject* stats = Py_BuildValue("{s:K,s:K,s:K,s:K}",
+        "live", (unsigned long long)ms.fLive,
+        "lookups", (unsigned long long)ms.fLookups,
+        "probes", (unsigned long long)ms.fProbes,
+        "max_probe", (unsigned long long)ms.fMaxProbe);
+
+    if (stats && pyclass && (((PyTypeObject*)pyclass)->tp_flags & Py_TPFLAGS_HEAPTYPE)) {
+        CPPClass* klass = (CPPClass*)pyclass;
+        CppToPyMap_t* cppobjs = (klass->fFlags & CPPScope::kIsNamespace) ? nullptr : klass->fImp.fCppObjects;
+        size_t size = 0, capacity = 0;
+        if (cppobjs) {
+            LockGuard_t lock(cppobjs->fMutex);
+            size = cppobjs->size();
+            capacity = cppobjs->capacity();
+        }
+        PyObject* pysize = PyLong_FromSize_t(size);
+        PyObject* pycap  = PyLong_FromSize_t(capacity);
+        PyDict_SetItemString(stats, "size", pysize);
+        PyDict_SetItemString(stats, "capacity", pycap);
+        Py_DECREF(pycap);
+        Py_DECREF(pysize);
+    }
+
+    return stats;
+}
 } // unnamed namespace
 
 
@@ -948,6 +1274,8 @@ static PyMethodDef gCPyCppyyMethods[] = {
       METH_VARARGS | METH_KEYWORDS, (char*)"Retrieve address of proxied object or field in a ctypes c_void_p."},
     {(char*)"bind_object", (PyCFunction)BindObject,
       METH_VARARGS | METH_KEYWORDS, (char*) "Create an object of given type, from given address."},
+    {(char*) "bind_array", (PyCFunction)BindArray,
+      METH_VARARGS, (char*) "Create a view on an array of objects of given type, from given address and size."},
     {(char*) "move", (PyCFunction)Move,
       METH_O, (char*)"Cast the C++ object to become movable."},
     {(char*) "add_pythonization", (PyCFunction)AddPythonization,
@@ -962,6 +1290,10 @@ static PyMethodDef gCPyCppyyMethods[] = {
       METH_VARARGS, (char*)"Determines object ownership model."},
     {(char*) "SetGlobalSignalPolicy", (PyCFunction)SetGlobalSignalPolicy,
       METH_VARARGS, (char*)"Trap signals in safe mode to prevent interpreter abort."},
+    {(char*) "SetGILPolicy", (PyCFunction)SetGILPolicy,
+      METH_VARARGS, (char*)"Set the GIL release policy, globally or for a scope."},
+    {(char*) "SetGILThreshold", (PyCFunction)SetGILThreshold,
+      METH_VARARGS, (char*)"Set the execution time (us) for adaptive GIL release."},
     {(char*) "SetOwnership", (PyCFunction)SetOwnership,
       METH_VARARGS, (char*)"Modify held C++ object ownership."},
     {(char*) "AddSmartPtrType", (PyCFunction)AddSmartPtrType,
@@ -970,6 +1302,20 @@ static PyMethodDef gCPyCppyyMethods[] = {
       METH_NOARGS, (char*) "Begin capturing stderr to a in memory buffer."},
     {(char*) "_end_capture_stderr", (PyCFunction)EndCaptureStderr,
       METH_NOARGS, (char*) "End capturing stderr and returns the captured buffer."},
+    {(char*) "_set_reflection_cache", (PyCFunction)SetReflectionCache,
+      METH_VARARGS, (char*) "Use a persistent cache of reflection data (path, fingerprint)."},
+    {(char*) "_set_lazy_class_build", (PyCFunction)SetLazyClassBuild,
+      METH_VARARGS, (char*) "Build class proxy members on first access (bool)."},
+    {(char*) "_bench_callback", (PyCFunction)BenchCallback,
+      METH_VARARGS | METH_KEYWORDS, (char*) "Report the cost per call of C++ calling back into python."},
+    {(char*) "_pool_stats", (PyCFunction)GetPoolStats,
+      METH_NOARGS, (char*) "Report use of shared argument converters and return executors."},
+    {(char*) "_call_arena_stats", (PyCFunction)GetCallArenaStats,
+      METH_NOARGS, (char*) "Report use of the per-thread call scratch memory."},
+    {(char*) "_proxy_freelist_stats", (PyCFunction)GetFreeListStats,
+      METH_VARARGS, (char*) "Report recycling of instance proxies, overall or for a class."},
+    {(char*) "_memreg_stats", (PyCFunction)GetMemRegStats,
+      METH_VARARGS, (char*) "Report use of the object identity tracking tables."},
     {nullptr, nullptr, 0, nullptr}
 };
 
@@ -1044,6 +1390,13 @@ extern "C" void initlibcppyy()
 // setup this module
 #if PY_VERSION_HEX >= 0x03000000
     gThisModule = PyModule_Create(&moduledef);
+// Note: the module is not (yet) declared free of the GIL on free-threaded builds, so
+// importing it re-enables the GIL (unless overridden with PYTHON_GIL=0 or -X gil=0).
+// The locks from Threading.h cover the factories, the dispatch caches, and tracked
+// objects, but the following still rely on the GIL:
+//   - the in-place priority sort of an overload's methods on first call;
+//   - the reference taken on a tracked proxy on lookup, vs. its deallocation;
+//   - the python class map, the proxy free list, and the lazy members of scopes.
 #else
     gThisModule = Py_InitModule(const_cast<char*>("libcppyy"), gCPyCppyyMethods);
 #endif
@@ -1105,6 +1458,12 @@ extern "C" void initlibcppyy()
     if (!Utility::InitProxy(gThisModule, &PyNullPtr_t_Type, "nullptr_t"))
         CPYCPPYY_INIT_ERROR;
 
+    if (!Utility::InitProxy(gThisModule, &InstanceArrayView_Type, "InstanceArrayView"))
+        CPYCPPYY_INIT_ERROR;
+
+    if (!Utility::InitProxy(gThisModule, &PyNoMemReg_Type, "no_memreg"))
+        CPYCPPYY_INIT_ERROR;
+
 // custom iterators
     if (PyType_Ready(&InstanceArrayIter_Type) < 0)
         CPYCPPYY_INIT_ERROR;
@@ -1115,6 +1474,9 @@ extern "C" void initlibcppyy()
     if (PyType_Ready(&VectorIter_Type) < 0)
         CPYCPPYY_INIT_ERROR;
 
+    if (PyType_Ready(&STLIter_Type) < 0)
+        CPYCPPYY_INIT_ERROR;
+
 // inject identifiable nullptr and default
     gNullPtrObject = (PyObject*)&_CPyCppyy_NullPtrStruct;
     Py_INCREF(gNullPtrObject);
@@ -1142,6 +1504,14 @@ extern "C" void initlibcppyy()
         PyInt_FromLong((int)CallContext::kUseHeuristics));
     PyModule_AddObject(gThisModule, (char*)"kMemoryStrict",
         PyInt_FromLong((int)CallContext::kUseStrict));
+    PyModule_AddObject(gThisModule, (char*)"kGILDefault",
+        PyInt_FromLong((int)CallContext::kGILDefault));
+    PyModule_AddObject(gThisModule, (char*)"kGILNever",
+        PyInt_FromLong((int)CallContext::kGILNever));
+    PyModule_AddObject(gThisModule, (char*)"kGILAlways",
+        PyInt_FromLong((int)CallContext::kGILAlways));
+    PyModule_AddObject(gThisModule, (char*)"kGILAdaptive",
+        PyInt_FromLong((int)CallContext::kGILAdaptive));
 
 // gbl namespace is injected in cppyy.py
 
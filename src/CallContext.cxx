@@ -1,6 +1,13 @@
 // Bindings
 #include "CPyCppyy.h"
 #include "CallContext.h"
+#include "Threading.h"
+
+// Standard
+#include <stdlib.h>
+#include <cstddef>
+#include <map>
+#include <new>
 
 
 //- data _____________________________________________________________________
@@ -10,31 +17,95 @@ namespace CPyCppyy {
 // this is just a data holder for linking; actual value is set in CPyCppyyModule.cxx
     CallContext::ECallFlags CallContext::sSignalPolicy = CallContext::kNone;
 
+    CallContext::EGILPolicy CallContext::sGILPolicy = CallContext::kGILNever;
+    uint64_t CallContext::sGILThreshold  = 50000;
+    uint64_t CallContext::sGILGeneration = 1;
+
+// per-scope GIL policies (few, if any, so a plain map will do)
+    static std::map<Cppyy::TCppScope_t, CallContext::EGILPolicy> gScopeGILPolicies;
+
 } // namespace CPyCppyy
 
 //-----------------------------------------------------------------------------
-void CPyCppyy::CallContext::AddTemporary(PyObject* pyobj) {
-    if (pyobj) {
-        if (!fTemps)
-            fTemps = new Temporary{pyobj, nullptr};
-        else {
-            Temporary* tmp = fTemps;
-            while (tmp->fNext) tmp = tmp->fNext;
-            tmp->fNext = new Temporary{pyobj, nullptr};
+CPyCppyy::CallArena& CPyCppyy::CallArena::Get()
+{
+    static thread_local CallArena sArena;
+    return sArena;
+}
+
+//-----------------------------------------------------------------------------
+CPyCppyy::CallArena::~CallArena()
+{
+    for (auto& b : fBlocks)
+        free(b.fMemory);
+}
+
+//-----------------------------------------------------------------------------
+void* CPyCppyy::CallArena::Allocate(size_t sz)
+{
+// bump allocate from the current block, moving on to the next (new if needed) block
+// if it does not fit; new blocks double in size, so that the arena settles quickly
+    const size_t kAlign = alignof(std::max_align_t);
+    const size_t kFirstBlockSize = 16*1024;
+    sz = (sz + kAlign - 1) & ~(kAlign - 1);
+
+    while (fCurrent < fBlocks.size()) {
+        Block_t& b = fBlocks[fCurrent];
+        if (fOffset + sz <= b.fSize) {
+            void* mem = b.fMemory + fOffset;
+            fOffset += sz;
+            return mem;
         }
+        fCurrent += 1;
+        fOffset = 0;
     }
+
+    size_t bsz = fBlocks.empty() ? kFirstBlockSize : 2*fBlocks.back().fSize;
+    while (bsz < sz) bsz *= 2;
+    char* mem = (char*)malloc(bsz);
+    if (!mem) throw std::bad_alloc{};
+    fBlocks.push_back(Block_t{mem, bsz});
+    fNHeapAllocs += 1;
+
+    fCurrent = fBlocks.size()-1;
+    fOffset = sz;
+    return mem;
+}
+
+
+//-----------------------------------------------------------------------------
+void CPyCppyy::CallContext::AddTemporary(const Temporary& tmp) {
+    Temporary* node = (Temporary*)Allocate(sizeof(Temporary));
+    *node = tmp;
+    if (!fTemps)
+        fTemps = node;
+    else
+        fTempsTail->fNext = node;
+    fTempsTail = node;
+}
+
+void CPyCppyy::CallContext::AddTemporary(PyObject* pyobj) {
+    if (pyobj)
+        AddTemporary(Temporary{pyobj, nullptr, nullptr, nullptr});
+}
+
+void CPyCppyy::CallContext::AddCleanup(void (*cleanup)(void*), void* data) {
+    if (cleanup)
+        AddTemporary(Temporary{nullptr, cleanup, data, nullptr});
 }
 
 //-----------------------------------------------------------------------------
 void CPyCppyy::CallContext::Cleanup() {
+// nodes live in the call arena, so only their payload needs releasing
     Temporary* tmp = fTemps;
     while (tmp) {
-        Py_DECREF(tmp->fPyObject);
-        Temporary* tmp2 = tmp->fNext;
-        delete tmp;
-        tmp = tmp2;
+        if (tmp->fPyObject)
+            Py_DECREF(tmp->fPyObject);
+        else
+            tmp->fCleanup(tmp->fData);
+        tmp = tmp->fNext;
     }
-    fTemps = nullptr;
+    fTemps = fTempsTail = nullptr;
 }
 
 //-----------------------------------------------------------------------------
@@ -59,3 +130,54 @@ bool CPyCppyy::CallContext::SetGlobalSignalPolicy(bool setProtected)
     return old;
 }
 
+//-----------------------------------------------------------------------------
+bool CPyCppyy::CallContext::SetGILPolicy(int policy, Cppyy::TCppScope_t scope)
+{
+// Set the GIL release policy for scope, or the global one if scope is 0 (for which
+// kGILDefault means kGILNever).
+    BindingsLockGuard_t lock(gBindingsLock);
+    if (policy < kGILDefault || kGILAdaptive < policy)
+        return false;
+
+    if (scope) {
+        if (policy == kGILDefault)
+            gScopeGILPolicies.erase(scope);
+        else
+            gScopeGILPolicies[scope] = (EGILPolicy)policy;
+    } else
+        sGILPolicy = policy == kGILDefault ? kGILNever : (EGILPolicy)policy;
+
+    sGILGeneration += 1;
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+CPyCppyy::CallContext::EGILPolicy CPyCppyy::CallContext::GetGILPolicy(Cppyy::TCppScope_t scope)
+{
+// Find the GIL policy in effect for scope, searching outwards through its parents.
+    BindingsLockGuard_t lock(gBindingsLock);
+    if (!gScopeGILPolicies.empty()) {
+        while (scope) {
+            auto p = gScopeGILPolicies.find(scope);
+            if (p != gScopeGILPolicies.end())
+                return p->second;
+            Cppyy::TCppScope_t parent = Cppyy::GetParentScope(scope);
+            if (parent == scope)
+                break;
+            scope = parent;
+        }
+    }
+
+    return sGILPolicy;
+}
+
+//-----------------------------------------------------------------------------
+uint64_t CPyCppyy::CallContext::SetGILThreshold(uint64_t ns)
+{
+// Set the execution time above which adaptive methods release the GIL; returns the
+// old value. Decisions already taken are re-evaluated.
+    uint64_t old = sGILThreshold;
+    sGILThreshold = ns;
+    sGILGeneration += 1;
+    return old;
+}
@@ -2,6 +2,8 @@
 #define CPYCPPYY_CALLCONTEXT_H
 
 // Standard
+#include <stdint.h>
+#include <string.h>
 #include <vector>
 
 #include <sys/types.h>
@@ -44,13 +46,60 @@ struct Parameter {
 };
 #endif // CPYCPPYY_PARAMETER
 
+// quality of the match of a python argument to a C++ parameter, from best to worst,
+// as estimated without converting (kMatchUnknown means that only conversion can tell)
+enum EMatch {
+    kMatchExact      = 0,     // no conversion needed (but the value may be out of range)
+    kMatchPromotion  = 1,     // standard conversion, e.g. int -> double
+    kMatchImplicit   = 2,     // needs implicit conversions (second stage only)
+    kMatchUnknown    = 3,
+    kMatchImpossible = 4      // conversion is certain to fail
+};
+
+// per-thread bump allocator for the scratch memory of calls (argument arrays beyond
+// SMALL_ARGS_N, temporaries, initializer_list backing stores); each CallContext takes
+// a mark on creation and resets the arena to it on destruction, so nested calls (e.g.
+// through callbacks) release their memory in LIFO order; blocks are kept for re-use
+class CallArena {
+public:
+    struct Mark_t { size_t fBlock; size_t fOffset; };
+
+    static CallArena& Get();
+
+    CallArena() : fCurrent(0), fOffset(0), fNCalls(0), fNHeapAllocs(0), fLastHeapAllocs(0) {}
+    CallArena(const CallArena&) = delete;
+    CallArena& operator=(const CallArena&) = delete;
+    ~CallArena();
+
+    void* Allocate(size_t sz);
+
+    Mark_t BeginCall() const { return Mark_t{fCurrent, fOffset}; }
+    void EndCall(const Mark_t& mark, uint64_t heapAllocs) {
+        fCurrent = mark.fBlock; fOffset = mark.fOffset;
+        fNCalls += 1;
+        fLastHeapAllocs = fNHeapAllocs - heapAllocs;
+    }
+
+public:
+    struct Block_t { char* fMemory; size_t fSize; };
+    std::vector<Block_t> fBlocks;
+    size_t   fCurrent;
+    size_t   fOffset;
+
+// statistics: heap allocations are those of new arena blocks
+    uint64_t fNCalls;
+    uint64_t fNHeapAllocs;
+    uint64_t fLastHeapAllocs;       // by the most recently finished call
+};
+
 // extra call information
 struct CallContext {
     CallContext() : fCurScope(0), fPyContext(nullptr), fFlags(0),
-        fArgsVec(nullptr), fNArgs(0), fTemps(nullptr) {}
+        fArgsBuf(nullptr), fArgsCapacity(0), fNArgs(0), fTemps(nullptr), fTempsTail(nullptr),
+        fArena(CallArena::Get()), fArenaMark(fArena.BeginCall()), fHeapAllocs(fArena.fNHeapAllocs) {}
     CallContext(const CallContext&) = delete;
     CallContext& operator=(const CallContext&) = delete;
-    ~CallContext() { if (fTemps) Cleanup(); delete fArgsVec; }
+    ~CallContext() { if (fTemps) Cleanup(); fArena.EndCall(fArenaMark, fHeapAllocs); }
 
     enum ECallFlags {
         kNone           = 0x000000,
@@ -72,6 +121,7 @@ struct CallContext {
         kProtected      = 0x008000, // if method should return on signals
         kUseFFI         = 0x010000, // not implemented
         kIsPseudoFunc   = 0x020000, // internal, used for introspection
+        kNoMemReg       = 0x040000, // if returned objects are not tracked for identity
     };
 
 // memory handling
@@ -79,23 +129,50 @@ struct CallContext {
     static bool SetMemoryPolicy(ECallFlags e);
 
     void AddTemporary(PyObject* pyobj);
+    void AddCleanup(void (*cleanup)(void*), void* data);
     void Cleanup();
 
+// scratch memory, valid until the end of the call
+    void* Allocate(size_t sz) { return fArena.Allocate(sz); }
+
 // signal safety
     static ECallFlags sSignalPolicy;
     static bool SetGlobalSignalPolicy(bool setProtected);
 
+// GIL release, for methods not explicitly flagged with kReleaseGIL: never, always, or
+// adaptive (release once the measured C++ execution time exceeds sGILThreshold); a
+// policy can be set per scope (applying to nested scopes), kGILDefault defers to the
+// enclosing scope and finally to the global policy
+    enum EGILPolicy {
+        kGILDefault     = -1,
+        kGILNever       =  0,
+        kGILAlways      =  1,
+        kGILAdaptive    =  2
+    };
+
+    static EGILPolicy sGILPolicy;
+    static uint64_t   sGILThreshold;      // in ns
+    static uint64_t   sGILGeneration;     // bumped on any change, to invalidate decisions
+    static bool SetGILPolicy(int policy, Cppyy::TCppScope_t scope = 0);
+    static EGILPolicy GetGILPolicy(Cppyy::TCppScope_t scope);
+    static uint64_t SetGILThreshold(uint64_t ns);
+
     Parameter* GetArgs(size_t sz) {
         if (sz != (size_t)-1) fNArgs = sz;
         if (fNArgs <= SMALL_ARGS_N) return fArgs;
-        if (!fArgsVec) fArgsVec = new std::vector<Parameter>();
-        fArgsVec->resize(fNArgs);
-        return fArgsVec->data();
+        if (fArgsCapacity < fNArgs) {
+            Parameter* args = (Parameter*)Allocate(fNArgs*sizeof(Parameter));
+            if (fArgsBuf) memcpy(args, fArgsBuf, fArgsCapacity*sizeof(Parameter));
+            memset(args+fArgsCapacity, 0, (fNArgs-fArgsCapacity)*sizeof(Parameter));
+            fArgsBuf = args;
+            fArgsCapacity = fNArgs;
+        }
+        return fArgsBuf;
     }
 
     Parameter* GetArgs() {
         if (fNArgs <= SMALL_ARGS_N) return fArgs;
-        return fArgsVec->data();
+        return fArgsBuf;
     }
 
     size_t GetSize() { return fNArgs; }
@@ -108,13 +185,27 @@ public:
     uint32_t           fFlags;
 
 private:
-    struct Temporary { PyObject* fPyObject; Temporary* fNext; };
+    struct Temporary {
+        PyObject*  fPyObject;
+        void     (*fCleanup)(void*);
+        void*      fData;
+        Temporary* fNext;
+    };
+
+    void AddTemporary(const Temporary& tmp);
 
 // payload
     Parameter               fArgs[SMALL_ARGS_N];
-    std::vector<Parameter>* fArgsVec;
+    Parameter*              fArgsBuf;
+    size_t                  fArgsCapacity;
     size_t                  fNArgs;
     Temporary*              fTemps;
+    Temporary*              fTempsTail;
+
+// scratch memory
+    CallArena&              fArena;
+    CallArena::Mark_t       fArenaMark;
+    uint64_t                fHeapAllocs;
 };
 
 inline bool IsSorted(uint64_t flags) {
@@ -0,0 +1,286 @@
+// Bindings
+#include "CPyCppyy.h"
+#include "CallbackTrampolines.h"
+#include "Converters.h"
+#include "TypeManip.h"
+#include "CPyCppyy/PyException.h"
+
+// Standard
+#include <stdint.h>
+#include <string.h>
+#include <type_traits>
+#include <utility>
+
+
+// the trampolines rely on all arguments being passed in (64b, little endian) registers,
+// with the value of narrower types in the low bytes
+#if defined(__x86_64__) || defined(_M_X64) || defined(_M_ARM64) || \
+        (defined(__aarch64__) && !defined(__AARCH64EB__))
+#define CPYCPPYY_CALLBACK_TRAMPOLINES 1
+#endif
+
+
+#ifdef CPYCPPYY_CALLBACK_TRAMPOLINES
+
+//- data _______________________________________________________________________
+namespace CPyCppyy {
+    bool Instance_IsLively(PyObject* pyobject);    // from API.h
+}
+
+namespace {
+
+using namespace CPyCppyy;
+
+// maximum number of arguments (all in registers on supported platforms) and the number
+// of trampolines per register pattern; freed trampolines are re-used through the cache
+// of function pointer wrappers, for the same signature
+const int kMaxArgs = 4;
+const int kNSlots  = 16;
+
+// register class of arguments and return values
+enum EKind { kVoid = 0, kInt = 1, kFloat = 2 };
+
+struct Slot_t {
+    PyObject*  fCallable = nullptr;          // borrowed, reset when the callable goes away
+    Converter* fRetConv  = nullptr;
+    bool       fRetIsPtr = false;
+    int        fNArgs    = 0;
+    Converter* fArgConvs[kMaxArgs] = {};
+    bool       fArgIsAddress[kMaxArgs] = {}; // register holds the address to convert from
+};
+
+
+//- trampolines ----------------------------------------------------------------
+inline uint64_t ToRaw(uint64_t val) { return val; }
+inline uint64_t ToRaw(double val)
+{
+    uint64_t raw; memcpy(&raw, &val, sizeof(raw));
+    return raw;
+}
+
+template<typename R> R FromRaw(uint64_t raw);
+template<> inline void FromRaw<void>(uint64_t) {}
+template<> inline uint64_t FromRaw<uint64_t>(uint64_t raw) { return raw; }
+template<> inline double FromRaw<double>(uint64_t raw)
+{
+    double val; memcpy(&val, &raw, sizeof(val));
+    return val;
+}
+
+uint64_t Dispatch(Slot_t& slot, uint64_t* raw);
+
+template<int Mask, size_t I>
+using Arg_t = typename std::conditional<(Mask >> I) & 1, double, uint64_t>::type;
+
+template<typename R, int Mask, typename Seq> struct Pool;
+
+template<typename R, int Mask, size_t... I>
+struct Pool<R, Mask, std::index_sequence<I...>> {
+    inline static Slot_t sSlots[kNSlots];
+    inline static int    sNUsed = 0;
+
+    template<int S>
+    static R Call(Arg_t<Mask, I>... args) {
+        uint64_t raw[sizeof...(I)+1] = {ToRaw(args)...};
+        return FromRaw<R>(Dispatch(sSlots[S], raw));
+    }
+
+    template<size_t... S>
+    static void* AddressOf(int islot, std::index_sequence<S...>) {
+        static void* const sAddresses[] = {(void*)&Call<(int)S>...};
+        return sAddresses[islot];
+    }
+
+    static void* Address(int islot) {
+        return AddressOf(islot, std::make_index_sequence<kNSlots>());
+    }
+};
+
+// argument patterns are numbered by count, then by floating point mask: () = 0,
+// (i) = 1, (f) = 2, (i, i) = 3, (f, i) = 4, etc.
+constexpr int kNPatterns = (1 << (kMaxArgs+1)) - 1;
+constexpr int PatternNArgs(int pattern)
+{
+    int nargs = 0;
+    while ((1 << (nargs+1)) - 1 <= pattern) ++nargs;
+    return nargs;
+}
+constexpr int PatternMask(int pattern) { return pattern - ((1 << PatternNArgs(pattern)) - 1); }
+
+template<int K>
+struct PoolAt {
+    typedef typename std::conditional<K / kNPatterns == kVoid, void,
+        typename std::conditional<K / kNPatterns == kInt, uint64_t, double>::type>::type R;
+    typedef Pool<R, PatternMask(K % kNPatterns),
+        std::make_index_sequence<PatternNArgs(K % kNPatterns)>> type;
+};
+
+struct PoolEntry_t {
+    Slot_t* fSlots;
+    int*    fNUsed;
+    void* (*fAddress)(int);
+};
+
+template<size_t... K>
+const PoolEntry_t* GetPools(std::index_sequence<K...>)
+{
+    static const PoolEntry_t sPools[] = {{PoolAt<(int)K>::type::sSlots,
+        &PoolAt<(int)K>::type::sNUsed, &PoolAt<(int)K>::type::Address}...};
+    return sPools;
+}
+
+
+//- helpers --------------------------------------------------------------------
+uint64_t Dispatch(Slot_t& slot, uint64_t* raw)
+{
+// call the python callable with the converted arguments and convert its result
+    uint64_t ret = 0;
+    const bool gilHeld = PyGILState_Check();
+    PyGILState_STATE state = gilHeld ? PyGILState_LOCKED : PyGILState_Ensure();
+
+    PyObject* pyargs[kMaxArgs];
+    int iarg = 0;
+    for (; iarg < slot.fNArgs; ++iarg) {
+        void* address = slot.fArgIsAddress[iarg] ? (void*)raw[iarg] : (void*)&raw[iarg];
+        pyargs[iarg] = slot.fArgConvs[iarg]->FromMemory(address);
+        if (!pyargs[iarg])
+            break;
+    }
+
+    PyObject* pyresult = nullptr;
+    if (iarg == slot.fNArgs) {
+        if (slot.fCallable)
+            pyresult = CPyCppyy_PyObject_Call(slot.fCallable, pyargs, slot.fNArgs, nullptr);
+        else
+            PyErr_SetString(PyExc_TypeError, "callable was deleted");
+    }
+    for (int i = 0; i < iarg; ++i)
+        Py_DECREF(pyargs[i]);
+
+    bool cOk = (bool)pyresult;
+    if (pyresult) {
+    // a pointer to a python-owned object about to go away would dangle, return null instead
+        if (slot.fRetConv && !(slot.fRetIsPtr && !Instance_IsLively(pyresult)))
+            cOk = slot.fRetConv->ToMemory(pyresult, (void*)&ret);
+        Py_DECREF(pyresult);
+    }
+
+    if (!cOk) {
+#ifndef _WIN32
+        PyException pyexc; if (!gilHeld) PyGILState_Release(state); throw pyexc;
+#endif
+    // as for the JIT-ed wrappers, leave the error be on Windows
+    }
+
+    if (!gilHeld) PyGILState_Release(state);
+    return ret;
+}
+
+bool IsScope(const std::string& name)
+{
+    return (bool)Cppyy::GetScope(TypeManip::clean_type(name));
+}
+
+int Classify(const std::string& type, bool isReturn, std::string& convType, bool& isAddress)
+{
+// determine the register class of type, and how to convert it (returns -1 if the type
+// is not passed in a register, or not supported)
+    convType = type;
+    isAddress = false;
+
+    if (isReturn && type == "void")
+        return kVoid;
+
+    const std::string& resolved = Cppyy::ResolveName(type);
+    const std::string& cpd = TypeManip::compound(resolved);
+    if (!cpd.empty()) {
+        if (cpd.find('[') != std::string::npos)
+            return -1;
+
+        bool isPtr = cpd.back() == '*';
+        if (isReturn)
+            return isPtr ? kInt : -1;
+
+    // as for the JIT-ed wrappers: class pointers are converted from the pointer value,
+    // and references from the address of the referenced object
+        if (IsScope(resolved)) {
+            convType = resolved.substr(0, resolved.size()-1);
+            isAddress = true;
+        } else
+            isAddress = !isPtr;
+        return kInt;
+    }
+
+    const std::string& clean = TypeManip::remove_const(resolved);
+    if (clean == "float" || clean == "double")
+        return kFloat;
+
+    static const char* sIntegers[] = {"bool", "char", "signed char", "unsigned char",
+        "wchar_t", "char8_t", "char16_t", "char32_t", "short", "unsigned short", "int",
+        "unsigned int", "long", "unsigned long", "long long", "unsigned long long"};
+    for (const char* name : sIntegers) {
+        if (clean == name)
+            return kInt;
+    }
+
+    if (Cppyy::IsEnumScope(Cppyy::GetScope(clean)))
+        return kInt;
+
+    return -1;
+}
+
+} // unnamed namespace
+
+#endif // CPYCPPYY_CALLBACK_TRAMPOLINES
+
+
+//- public functions -----------------------------------------------------------
+void* CPyCppyy::AcquireCallbackTrampoline(const std::string& rettype,
+    const std::vector<std::string>& argtypes, PyObject**& ref)
+{
+#ifdef CPYCPPYY_CALLBACK_TRAMPOLINES
+    static const PoolEntry_t* sPools = GetPools(std::make_index_sequence<3*kNPatterns>());
+
+    int nArgs = (int)argtypes.size();
+    if (kMaxArgs < nArgs)
+        return nullptr;
+
+// classify the signature
+    std::string retConvType, argConvTypes[kMaxArgs];
+    bool isAddress, argIsAddress[kMaxArgs];
+    int retKind = Classify(rettype, true, retConvType, isAddress);
+    if (retKind < 0)
+        return nullptr;
+
+    int mask = 0;
+    for (int iarg = 0; iarg < nArgs; ++iarg) {
+        int kind = Classify(argtypes[iarg], false, argConvTypes[iarg], argIsAddress[iarg]);
+        if (kind < 0)
+            return nullptr;
+        if (kind == kFloat)
+            mask |= 1 << iarg;
+    }
+
+    const PoolEntry_t& pool = sPools[retKind*kNPatterns + (1 << nArgs) - 1 + mask];
+    if (*pool.fNUsed == kNSlots)
+        return nullptr;
+
+// set up the converters for the actual types
+    Slot_t& slot = pool.fSlots[*pool.fNUsed];
+    if (retKind != kVoid) {
+        slot.fRetConv = CreateConverter(retConvType);
+        slot.fRetIsPtr = Cppyy::ResolveName(rettype).back() == '*';
+    }
+    slot.fNArgs = nArgs;
+    for (int iarg = 0; iarg < nArgs; ++iarg) {
+        slot.fArgConvs[iarg] = CreateConverter(argConvTypes[iarg]);
+        slot.fArgIsAddress[iarg] = argIsAddress[iarg];
+    }
+
+    ref = &slot.fCallable;
+    return pool.fAddress((*pool.fNUsed)++);
+#else
+    (void)rettype; (void)argtypes; (void)ref;
+    return nullptr;
+#endif
+}
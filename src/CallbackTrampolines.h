@@ -0,0 +1,24 @@
+#ifndef CPYCPPYY_CALLBACKTRAMPOLINES_H
+#define CPYCPPYY_CALLBACKTRAMPOLINES_H
+
+// Standard
+#include <string>
+#include <vector>
+
+
+namespace CPyCppyy {
+
+// Precompiled C entry points for python callables passed as C++ function pointers.
+// Arguments and return values of builtin arithmetic, enum, pointer and reference
+// types are passed in registers that depend only on their class (integer or floating
+// point), for up to 4 arguments, so a fixed set of trampolines per register pattern
+// serves all such signatures, with the converters for the actual types selected at
+// run-time. Returns the address of an unused trampoline, or nullptr if the signature
+// is not covered (or the pool is exhausted), in which case a wrapper should be JIT-ed;
+// ref is set to the location that holds the (borrowed) callable for the trampoline.
+void* AcquireCallbackTrampoline(const std::string& rettype,
+    const std::vector<std::string>& argtypes, PyObject**& ref);
+
+} // namespace CPyCppyy
+
+#endif // !CPYCPPYY_CALLBACKTRAMPOLINES_H
@@ -1,6 +1,7 @@
 // Bindings
 #include "CPyCppyy.h"
 #include "DeclareConverters.h"
+#include "CallbackTrampolines.h"
 #include "CallContext.h"
 #include "CPPExcInstance.h"
 #include "CPPInstance.h"
@@ -11,6 +12,7 @@
 #include "ProxyWrappers.h"
 #include "PyStrings.h"
 #include "TemplateProxy.h"
+#include "Threading.h"
 #include "TupleOfInstances.h"
 #include "TypeManip.h"
 #include "Utility.h"
@@ -26,6 +28,7 @@
 #include <regex>
 #include <utility>
 #include <sstream>
+#include <unordered_map>
 #if __cplusplus > 201402L
 #include <cstddef>
 #include <string_view>
@@ -50,9 +53,24 @@
 namespace CPyCppyy {
 
 // factories
-    typedef std::map<std::string, cf_t> ConvFactories_t;
+    typedef std::unordered_map<std::string, cf_t> ConvFactories_t;
     static ConvFactories_t gConvFactories;
 
+// memoized resolutions of types and type names to factories (only where the factory
+// is used as-is); cleared whenever factories are (un)registered
+    typedef std::unordered_map<Cppyy::TCppType_t, cf_t> ConvFactoryMemo_t;
+    static ConvFactoryMemo_t gConvFactoryMemo;
+    static ConvFactories_t gConvFactoryNameMemo;
+
+// pool of shared converters for method arguments, by type, with reference counts kept
+// per converter, so that converters outlive the (re)registration of factories
+    typedef std::unordered_map<Cppyy::TCppType_t, Converter*> ConvPool_t;
+    static ConvPool_t gConvPool;
+    struct ConvPoolRef_t { Cppyy::TCppType_t fType; size_t fRefCount; };
+    static std::unordered_map<Converter*, ConvPoolRef_t> gConvPoolRefs;
+    static size_t   gConvPoolReferences = 0;
+    static uint64_t gConvPoolHits = 0;
+
 // special objects
     extern PyObject* gNullPtrObject;
     extern PyObject* gDefaultObject;
@@ -367,6 +385,107 @@ static inline PY_LONG_LONG CPyCppyy_PyLong_AsStrictLongLong(PyObject* pyobject)
 }
 
 
+//- helpers for side-effect free match estimates (see Converter::CanConvert) -
+static inline bool IsNeverNumber(PyObject* pyobject)
+{
+// builtin (exact) types that are rejected by all numeric conversions
+    return pyobject == Py_None || CPyCppyy_PyText_CheckExact(pyobject) ||
+        PyBytes_CheckExact(pyobject) || PyTuple_CheckExact(pyobject) ||
+        PyList_CheckExact(pyobject) || PyDict_CheckExact(pyobject);
+}
+
+static inline CPyCppyy::EMatch MatchInteger(PyObject* pyobject)
+{
+// match for the strict integer conversions, which require a python int (or a
+// ctypes object of the same type, which is left to SetArg)
+    using namespace CPyCppyy;
+    if (PyBool_Check(pyobject))
+        return kMatchPromotion;
+    if (PyLong_Check(pyobject) || pyobject == gDefaultObject)
+        return kMatchExact;
+    if (PyFloat_Check(pyobject) || IsNeverNumber(pyobject) || CPPInstance_Check(pyobject))
+        return kMatchImpossible;
+    return kMatchUnknown;
+}
+
+static inline CPyCppyy::EMatch MatchImplicitBoolInteger(PyObject* pyobject)
+{
+// as MatchInteger, but bool -> int is an implicit conversion (see ImplicitBool)
+    if (PyBool_Check(pyobject))
+        return CPyCppyy::kMatchImplicit;
+    return MatchInteger(pyobject);
+}
+
+static inline CPyCppyy::EMatch MatchBool(PyObject* pyobject)
+{
+// match for bool; integers are accepted if 0 or 1, floats never
+    using namespace CPyCppyy;
+    if (PyBool_Check(pyobject))
+        return kMatchExact;
+    if (PyLong_Check(pyobject) || pyobject == gDefaultObject)
+        return kMatchPromotion;
+    if (PyFloat_Check(pyobject) || IsNeverNumber(pyobject))
+        return kMatchImpossible;
+    return kMatchUnknown;
+}
+
+static inline CPyCppyy::EMatch MatchStrictBool(PyObject* pyobject)
+{
+// as MatchBool, but anything other than bool is an implicit conversion (see StrictBool)
+    CPyCppyy::EMatch m = MatchBool(pyobject);
+    return m == CPyCppyy::kMatchPromotion ? CPyCppyy::kMatchImplicit : m;
+}
+
+static inline CPyCppyy::EMatch MatchFloat(PyObject* pyobject)
+{
+// match for the floating point conversions, which accept anything with __float__
+// or __index__, so only the builtin types are conclusive
+    using namespace CPyCppyy;
+    if (PyFloat_Check(pyobject) || pyobject == gDefaultObject)
+        return kMatchExact;
+    if (PyLong_Check(pyobject))
+        return kMatchPromotion;
+    if (IsNeverNumber(pyobject))
+        return kMatchImpossible;
+    return kMatchUnknown;
+}
+
+static inline CPyCppyy::EMatch MatchNoBoolFloat(PyObject* pyobject)
+{
+// as MatchFloat, but bool is refused outright
+    if (PyBool_Check(pyobject))
+        return CPyCppyy::kMatchImpossible;
+    return MatchFloat(pyobject);
+}
+
+static inline CPyCppyy::EMatch MatchChar(PyObject* pyobject)
+{
+// match for char types, which take a string of size 1 or a small int (see ExtractChar)
+    using namespace CPyCppyy;
+    if (PyBytes_Check(pyobject))
+        return PyBytes_GET_SIZE(pyobject) == 1 ? kMatchExact : kMatchImpossible;
+    if (CPyCppyy_PyText_Check(pyobject))
+        return CPyCppyy_PyText_GET_SIZE(pyobject) == 1 ? kMatchExact : kMatchImpossible;
+    if (pyobject == gDefaultObject)
+        return kMatchExact;
+    if (PyLong_Check(pyobject))
+        return kMatchPromotion;
+    if (PyFloat_Check(pyobject) || IsNeverNumber(pyobject))
+        return kMatchImpossible;
+    return kMatchUnknown;
+}
+
+static inline CPyCppyy::EMatch MatchWideChar(PyObject* pyobject, Py_ssize_t minsize, Py_ssize_t maxsize)
+{
+// match for the wide char types, which take only a (short) unicode string
+    using namespace CPyCppyy;
+    if (!PyUnicode_Check(pyobject))
+        return kMatchImpossible;
+    Py_ssize_t sz = CPyCppyy_PyUnicode_GET_SIZE(pyobject);
+    return (minsize <= sz && sz <= maxsize) ? kMatchExact : kMatchImpossible;
+}
+
+
 //- helper for pointer/array/reference conversions ---------------------------
 static inline bool CArraySetArg(
     PyObject* pyobject, CPyCppyy::Parameter& para, char tc, int size, bool check=true)
@@ -1187,6 +1306,61 @@ bool CPyCppyy::ULLongConverter::ToMemory(PyObject* value, void* address, PyObjec
     return true;
 }
 
+//----------------------------------------------------------------------------
+#define CPPYY_IMPL_CONVERTER_MATCH(name, match)                              \
+CPyCppyy::EMatch CPyCppyy::name##Converter::CanConvert(PyObject* pyobject)   \
+{                                                                            \
+    return match(pyobject);                                                  \
+}
+
+CPPYY_IMPL_CONVERTER_MATCH(Bool,            MatchStrictBool)
+CPPYY_IMPL_CONVERTER_MATCH(Char,            MatchChar)
+CPPYY_IMPL_CONVERTER_MATCH(UChar,           MatchChar)
+CPPYY_IMPL_CONVERTER_MATCH(Int8,            MatchImplicitBoolInteger)
+CPPYY_IMPL_CONVERTER_MATCH(UInt8,           MatchImplicitBoolInteger)
+CPPYY_IMPL_CONVERTER_MATCH(Short,           MatchImplicitBoolInteger)
+CPPYY_IMPL_CONVERTER_MATCH(UShort,          MatchImplicitBoolInteger)
+CPPYY_IMPL_CONVERTER_MATCH(Int,             MatchImplicitBoolInteger)
+CPPYY_IMPL_CONVERTER_MATCH(Long,            MatchImplicitBoolInteger)
+CPPYY_IMPL_CONVERTER_MATCH(ULong,           MatchImplicitBoolInteger)
+CPPYY_IMPL_CONVERTER_MATCH(LLong,           MatchImplicitBoolInteger)
+CPPYY_IMPL_CONVERTER_MATCH(ULLong,          MatchImplicitBoolInteger)
+CPPYY_IMPL_CONVERTER_MATCH(Float,           MatchNoBoolFloat)
+CPPYY_IMPL_CONVERTER_MATCH(Double,          MatchNoBoolFloat)
+CPPYY_IMPL_CONVERTER_MATCH(LDouble,         MatchNoBoolFloat)
+
+CPPYY_IMPL_CONVERTER_MATCH(ConstBoolRef,    MatchBool)
+CPPYY_IMPL_CONVERTER_MATCH(ConstCharRef,    MatchChar)
+CPPYY_IMPL_CONVERTER_MATCH(ConstUCharRef,   MatchChar)
+CPPYY_IMPL_CONVERTER_MATCH(ConstInt8Ref,    MatchInteger)
+CPPYY_IMPL_CONVERTER_MATCH(ConstUInt8Ref,   MatchInteger)
+CPPYY_IMPL_CONVERTER_MATCH(ConstShortRef,   MatchInteger)
+CPPYY_IMPL_CONVERTER_MATCH(ConstUShortRef,  MatchInteger)
+CPPYY_IMPL_CONVERTER_MATCH(ConstIntRef,     MatchInteger)
+CPPYY_IMPL_CONVERTER_MATCH(ConstUIntRef,    MatchInteger)
+CPPYY_IMPL_CONVERTER_MATCH(ConstLongRef,    MatchInteger)
+CPPYY_IMPL_CONVERTER_MATCH(ConstULongRef,   MatchInteger)
+CPPYY_IMPL_CONVERTER_MATCH(ConstLLongRef,   MatchInteger)
+CPPYY_IMPL_CONVERTER_MATCH(ConstULLongRef,  MatchInteger)
+CPPYY_IMPL_CONVERTER_MATCH(ConstFloatRef,   MatchFloat)
+CPPYY_IMPL_CONVERTER_MATCH(ConstDoubleRef,  MatchFloat)
+CPPYY_IMPL_CONVERTER_MATCH(ConstLDoubleRef, MatchFloat)
+
+CPyCppyy::EMatch CPyCppyy::WCharConverter::CanConvert(PyObject* pyobject)
+{
+    return MatchWideChar(pyobject, 1, 1);
+}
+
+CPyCppyy::EMatch CPyCppyy::Char16Converter::CanConvert(PyObject* pyobject)
+{
+    return MatchWideChar(pyobject, 1, 1);
+}
+
+CPyCppyy::EMatch CPyCppyy::Char32Converter::CanConvert(PyObject* pyobject)
+{
+    return MatchWideChar(pyobject, 0, 2);
+}
+
 //----------------------------------------------------------------------------
 bool CPyCppyy::CStringConverter::SetArg(
     PyObject* pyobject, Parameter& para, CallContext* ctxt)
@@ -2012,8 +2186,8 @@ PyObject* CPyCppyy::InstancePtrConverter<ISCONST>::FromMemory(void* address)
 {
 // construct python object from C++ instance read at <address>
     if (ISCONST)
-        return BindCppObject(*(void**)address, fClass);                   // by pointer value
-    return BindCppObject(address, fClass, CPPInstance::kIsReference);     // modifiable
+        return BindCppObject(*(void**)address, fPyClass);                 // by pointer value
+    return BindCppObject(address, fPyClass, CPPInstance::kIsReference);   // modifiable
 }
 
 //----------------------------------------------------------------------------
@@ -2081,14 +2255,14 @@ PyObject* CPyCppyy::InstanceConverter::FromMemory(void* address)
 // here means callbacks receive down-casted object when passed by-ptr, which is
 // needed for object identity. The latter case is assumed to be more common than
 // conversion of (global) objects.
-    return BindCppObject((Cppyy::TCppObject_t)address, fClass);
+    return BindCppObject((Cppyy::TCppObject_t)address, fPyClass);
 }
 
 //----------------------------------------------------------------------------
 bool CPyCppyy::InstanceConverter::ToMemory(PyObject* value, void* address, PyObject* /* ctxt */)
 {
 // assign value to C++ instance living at <address> through assignment operator
-    PyObject* pyobj = BindCppObjectNoCast(address, fClass);
+    PyObject* pyobj = BindCppObjectNoCast(address, fPyClass);
     PyObject* result = PyObject_CallMethod(pyobj, (char*)"__assign__", (char*)"O", value);
     Py_DECREF(pyobj);
 
@@ -2159,7 +2333,7 @@ bool CPyCppyy::InstanceRefConverter::SetArg(
 //----------------------------------------------------------------------------
 PyObject* CPyCppyy::InstanceRefConverter::FromMemory(void* address)
 {
-    return BindCppObjectNoCast((Cppyy::TCppObject_t)address, fClass, CPPInstance::kIsReference);
+    return BindCppObjectNoCast((Cppyy::TCppObject_t)address, fPyClass, CPPInstance::kIsReference);
 }
 
 //----------------------------------------------------------------------------
@@ -2232,7 +2406,7 @@ template <bool ISREFERENCE>
 PyObject* CPyCppyy::InstancePtrPtrConverter<ISREFERENCE>::FromMemory(void* address)
 {
 // construct python object from C++ instance* read at <address>
-    return BindCppObject(*(void**)address, fClass, CPPInstance::kIsReference | CPPInstance::kIsPtrPtr);
+    return BindCppObject(*(void**)address, fPyClass, CPPInstance::kIsReference | CPPInstance::kIsPtrPtr);
 }
 
 //----------------------------------------------------------------------------
@@ -2416,6 +2590,12 @@ bool CPyCppyy::PyObjectConverter::SetArg(
     return true;
 }
 
+CPyCppyy::EMatch CPyCppyy::PyObjectConverter::CanConvert(PyObject*)
+{
+// by definition: anything goes
+    return kMatchExact;
+}
+
 PyObject* CPyCppyy::PyObjectConverter::FromMemory(void* address)
 {
 // construct python object from C++ PyObject* read at <address>
@@ -2450,6 +2630,7 @@ static std::map<void*, PyObject**> sWrapperReference;
 
 static PyObject* WrapperCacheEraser(PyObject*, PyObject* pyref)
 {
+    CPyCppyy::BindingsLockGuard_t lock(CPyCppyy::gBindingsLock);
     auto ipos = sWrapperWeakRefs.find(pyref);
     if (ipos != sWrapperWeakRefs.end()) {
         auto key = ipos->second.second;
@@ -2480,6 +2661,7 @@ static void* PyFunction_AsCPointer(PyObject* pyobject,
 {
 // Convert a bound C++ function pointer or callable python object to a C-style
 // function pointer. The former is direct, the latter involves a JIT-ed wrapper.
+    CPyCppyy::BindingsLockGuard_t lock(CPyCppyy::gBindingsLock);
     static PyObject* sWrapperCacheEraser = PyCFunction_New(&gWrapperCacheEraserMethodDef, nullptr);
 
     using namespace CPyCppyy;
@@ -2544,6 +2726,21 @@ static void* PyFunction_AsCPointer(PyObject* pyobject,
            }
         }
 
+     // use a precompiled trampoline if the signature allows, JIT a wrapper otherwise
+        PyObject** ref = nullptr;
+        if (!wpraddress) {
+            const std::vector<std::string>& argtypes = TypeManip::extract_arg_types(signature);
+            wpraddress = AcquireCallbackTrampoline(rettype, argtypes, ref);
+            if (wpraddress) {
+                *ref = pyobject;
+                sWrapperReference[wpraddress] = ref;
+                sWrapperLookup[key][pyobject] = wpraddress;
+                PyObject* wref = PyWeakref_NewRef(pyobject, sWrapperCacheEraser);
+                if (wref) sWrapperWeakRefs[wref] = std::make_pair(wpraddress, key);
+                else PyErr_Clear();     // happens for builtins which don't need this
+            }
+        }
+
      // create wrapper if no re-use possible
         if (!wpraddress) {
             if (!Utility::IncludePython())
@@ -2571,16 +2768,21 @@ static void* PyFunction_AsCPointer(PyObject* pyobject,
             Utility::ConstructCallbackPreamble(rettype, argtypes, code);
 
         // create a referencable pointer
-            PyObject** ref = new PyObject*{pyobject};
+            ref = new PyObject*{pyobject};
 
         // function call itself and cleanup
             code << "    PyObject** ref = (PyObject**)" << (intptr_t)ref << ";\n"
                     "    PyObject* pyresult = nullptr;\n"
+#if PY_VERSION_HEX >= 0x03090000
+                    "    if (*ref) pyresult = PyObject_Vectorcall(*ref, pyargs+1, "
+                 << nArgs << " | PY_VECTORCALL_ARGUMENTS_OFFSET, NULL);\n";
+#else
                     "    if (*ref) pyresult = PyObject_CallFunctionObjArgs(*ref";
             for (int i = 0; i < nArgs; ++i)
-                code << ", pyargs[" << i << "]";
-            code << ", NULL);\n"
-                    "    else PyErr_SetString(PyExc_TypeError, \"callable was deleted\");\n";
+                code << ", pyargs[" << i+1 << "]";
+            code << ", NULL);\n";
+#endif
+            code << "    else PyErr_SetString(PyExc_TypeError, \"callable was deleted\");\n";
 
         // close
             Utility::ConstructCallbackReturn(rettype, nArgs, code);
@@ -2828,6 +3030,34 @@ struct faux_initlist
 #define NO_KNOWN_INITIALIZER_LIST 1
 #endif
 
+#ifndef NO_KNOWN_INITIALIZER_LIST
+static void DestructInitList(faux_initlist* fake, Cppyy::TCppType_t valueType, size_t valueSize)
+{
+#if defined (_LIBCPP_INITIALIZER_LIST) || defined(__GNUC__)
+    for (faux_initlist::size_type i = 0; i < fake->_M_len; ++i) {
+#elif defined (_MSC_VER)
+    for (size_t i = 0; (fake->_M_array+i*valueSize) != fake->_Last; ++i) {
+#endif
+        void* memloc = (char*)fake->_M_array + i*valueSize;
+        Cppyy::CallDestructor(valueType, (Cppyy::TCppObject_t)memloc);
+    }
+}
+
+// initializer lists in call scratch memory have their entries destroyed at the end
+// of the call, through the call context's clean-up
+struct InitListCleanup_t {
+    faux_initlist*    fList;
+    Cppyy::TCppType_t fValueType;
+    size_t            fValueSize;
+};
+
+static void CleanupInitList(void* data)
+{
+    InitListCleanup_t* c = (InitListCleanup_t*)data;
+    DestructInitList(c->fList, c->fValueType, c->fValueSize);
+}
+#endif
+
 } // unnamed namespace
 
 CPyCppyy::InitializerListConverter::~InitializerListConverter()
@@ -2837,17 +3067,10 @@ CPyCppyy::InitializerListConverter::~InitializerListConverter()
 }
 
 void CPyCppyy::InitializerListConverter::Clear() {
-    if (fValueType) {
-        faux_initlist* fake = (faux_initlist*)fBuffer;
-#if defined (_LIBCPP_INITIALIZER_LIST) || defined(__GNUC__)
-        for (faux_initlist::size_type i = 0; i < fake->_M_len; ++i) {
-#elif defined (_MSC_VER)
-        for (size_t i = 0; (fake->_M_array+i*fValueSize) != fake->_Last; ++i) {
+#ifndef NO_KNOWN_INITIALIZER_LIST
+    if (fValueType)
+        DestructInitList((faux_initlist*)fBuffer, fValueType, fValueSize);
 #endif
-            void* memloc = (char*)fake->_M_array + i*fValueSize;
-            Cppyy::CallDestructor(fValueType, (Cppyy::TCppObject_t)memloc);
-        }
-    }
 
     free(fBuffer);
     fBuffer = nullptr;
@@ -2876,14 +3099,19 @@ bool CPyCppyy::InitializerListConverter::SetArg(
     if (CPPInstance_Check(pyobject))
         return this->InstanceConverter::SetArg(pyobject, para, ctxt);
 
+// the list storage is scratch memory of the call, if available, or owned otherwise
+    auto allocate = [this, ctxt](size_t sz) {
+        if (ctxt) return ctxt->Allocate(sz);
+        return fBuffer = malloc(sz);
+    };
+
     void* buf = nullptr;
     Py_ssize_t buflen = Utility::GetBuffer(pyobject, '*', (int)fValueSize, buf, true);
     faux_initlist* fake = nullptr;
     size_t entries = 0;
     if (buf && buflen) {
     // dealing with an array here, pass on whole-sale
-        fake = (faux_initlist*)malloc(sizeof(faux_initlist));
-        fBuffer = (void*)fake;
+        fake = (faux_initlist*)allocate(sizeof(faux_initlist));
         fake->_M_array = (faux_initlist::iterator)buf;
 #if defined (_LIBCPP_INITIALIZER_LIST) || defined(__GNUC__)
         fake->_M_len = (faux_initlist::size_type)buflen;
@@ -2893,8 +3121,7 @@ bool CPyCppyy::InitializerListConverter::SetArg(
     } else if (fValueSize) {
     // can only construct empty lists, so use a fake initializer list
         size_t len = (size_t)PySequence_Size(pyobject);
-        fake = (faux_initlist*)malloc(sizeof(faux_initlist)+fValueSize*len);
-        fBuffer = (void*)fake;
+        fake = (faux_initlist*)allocate(sizeof(faux_initlist)+fValueSize*len);
         fake->_M_array = (faux_initlist::iterator)((char*)fake+sizeof(faux_initlist));
 #if defined (_LIBCPP_INITIALIZER_LIST) || defined(__GNUC__)
         fake->_M_len = (faux_initlist::size_type)len;
@@ -2936,10 +3163,19 @@ bool CPyCppyy::InitializerListConverter::SetArg(
 #elif defined (_MSC_VER)
                 fake->_Last = fake->_M_array+entries*fValueSize;
 #endif
-                Clear();
+                if (fBuffer)
+                    Clear();
+                else if (fValueType)
+                    DestructInitList(fake, fValueType, fValueSize);
                 return false;
             }
         }
+
+        if (ctxt && fValueType) {
+            InitListCleanup_t* c = (InitListCleanup_t*)ctxt->Allocate(sizeof(InitListCleanup_t));
+            *c = InitListCleanup_t{fake, fValueType, fValueSize};
+            ctxt->AddCleanup(CleanupInitList, c);
+        }
     }
 
     if (!fake)     // no buffer and value size indeterminate
@@ -2999,6 +3235,7 @@ CPyCppyy::Converter* CPyCppyy::CreateConverter(const std::string& fullType, cdim
 //   5) generalized cases (covers basically all C++ classes)
 //
 // If all fails, void is used, which will generate a run-time warning when used.
+    BindingsLockGuard_t lock(gBindingsLock);
 
 // an exactly matching converter is best
     ConvFactories_t::iterator h = gConvFactories.find(fullType);
@@ -3006,6 +3243,11 @@ CPyCppyy::Converter* CPyCppyy::CreateConverter(const std::string& fullType, cdim
         return (h->second)(dims);
     }
 
+// next best is a name that was resolved before
+    h = gConvFactoryNameMemo.find(fullType);
+    if (h != gConvFactoryNameMemo.end())
+        return (h->second)(dims);
+
 // resolve typedefs etc.
     const std::string& resolvedType = Cppyy::ResolveName(fullType);
 
@@ -3013,7 +3255,7 @@ CPyCppyy::Converter* CPyCppyy::CreateConverter(const std::string& fullType, cdim
     if (resolvedType != fullType) {
         h = gConvFactories.find(resolvedType);
         if (h != gConvFactories.end())
-            return (h->second)(dims);
+            return (gConvFactoryNameMemo[fullType] = h->second)(dims);
     }
 
 //-- nothing? ok, collect information about the type and possible qualifiers/decorators
@@ -3024,14 +3266,14 @@ CPyCppyy::Converter* CPyCppyy::CreateConverter(const std::string& fullType, cdim
 // accept unqualified type (as python does not know about qualifiers)
     h = gConvFactories.find((isConst ? "const " : "") + realType + cpd);
     if (h != gConvFactories.end())
-        return (h->second)(dims);
+        return (gConvFactoryNameMemo[fullType] = h->second)(dims);
 
 // drop const, as that is mostly meaningless to python (with the exception
 // of c-strings, but those are specialized in the converter map)
     if (isConst) {
         h = gConvFactories.find(realType + cpd);
         if (h != gConvFactories.end())
-            return (h->second)(dims);
+            return (gConvFactoryNameMemo[fullType] = h->second)(dims);
     }
 
 //-- still nothing? try pointer instead of array (for builtins)
@@ -3068,7 +3310,7 @@ CPyCppyy::Converter* CPyCppyy::CreateConverter(const std::string& fullType, cdim
     // fixed array, dims will have size if available
         h = gConvFactories.find(realType + " ptr");
         if (h != gConvFactories.end())
-            return (h->second)(dims);
+            return (gConvFactoryNameMemo[fullType] = h->second)(dims);
     }
 
 //-- special case: initializer list
@@ -3149,7 +3391,7 @@ CPyCppyy::Converter* CPyCppyy::CreateConverter(const std::string& fullType, cdim
     // for builtin, can use const-ref for r-ref
         h = gConvFactories.find("const " + realType + "&");
         if (h != gConvFactories.end())
-            return (h->second)(dims);
+            return (gConvFactoryNameMemo[fullType] = h->second)(dims);
     // else, unhandled moves
         result = new NotImplementedConverter();
     }
@@ -3181,12 +3423,18 @@ CPyCppyy::Converter* CPyCppyy::CreateConverter(Cppyy::TCppType_t type, cdims_t d
 //   5) generalized cases (covers basically all C++ classes)
 //
 // If all fails, void is used, which will generate a run-time warning when used.
+    BindingsLockGuard_t lock(gBindingsLock);
+
+// a type that was resolved before takes a single lookup
+    auto m = gConvFactoryMemo.find(type);
+    if (m != gConvFactoryMemo.end())
+        return (m->second)(dims);
 
 // an exactly matching converter is best
     std::string fullType = Cppyy::GetTypeAsString(type);
     ConvFactories_t::iterator h = gConvFactories.find(fullType);
     if (h != gConvFactories.end()) {
-        return (h->second)(dims);
+        return (gConvFactoryMemo[type] = h->second)(dims);
     }
 
 // resolve typedefs etc.
@@ -3197,7 +3445,7 @@ CPyCppyy::Converter* CPyCppyy::CreateConverter(Cppyy::TCppType_t type, cdims_t d
     if (resolvedTypeStr != fullType) {
         h = gConvFactories.find(resolvedTypeStr);
         if (h != gConvFactories.end()) {
-            return (h->second)(dims);
+            return (gConvFactoryMemo[type] = h->second)(dims);
         }
     }
 
@@ -3211,7 +3459,7 @@ CPyCppyy::Converter* CPyCppyy::CreateConverter(Cppyy::TCppType_t type, cdims_t d
 // accept unqualified type (as python does not know about qualifiers)
     h = gConvFactories.find((isConst ? "const " : "") + realTypeStr + cpd);
     if (h != gConvFactories.end()) {
-        return (h->second)(dims);
+        return (gConvFactoryMemo[type] = h->second)(dims);
     }
 
 // drop const, as that is mostly meaningless to python (with the exception
@@ -3219,7 +3467,7 @@ CPyCppyy::Converter* CPyCppyy::CreateConverter(Cppyy::TCppType_t type, cdims_t d
     if (isConst) {
         h = gConvFactories.find(realTypeStr + cpd);
         if (h != gConvFactories.end()) {
-            return (h->second)(dims);
+            return (gConvFactoryMemo[type] = h->second)(dims);
         }
     }
 
@@ -3257,7 +3505,7 @@ CPyCppyy::Converter* CPyCppyy::CreateConverter(Cppyy::TCppType_t type, cdims_t d
     // fixed array, dims will have size if available
         h = gConvFactories.find(realTypeStr + " ptr");
         if (h != gConvFactories.end())
-            return (h->second)(dims);
+            return (gConvFactoryMemo[type] = h->second)(dims);
     }
 
 //-- special case: initializer list
@@ -3351,11 +3599,10 @@ CPyCppyy::Converter* CPyCppyy::CreateConverter(Cppyy::TCppType_t type, cdims_t d
     // for builtin, can use const-ref for r-ref
         h = gConvFactories.find("const " + realTypeStr + " &");
         if (h != gConvFactories.end())
-            return (h->second)(dims);
-        std::string temp ="const " + realUnresolvedTypeStr + " &";
+            return (gConvFactoryMemo[type] = h->second)(dims);
         h = gConvFactories.find("const " + realUnresolvedTypeStr + " &");
         if (h != gConvFactories.end())
-            return (h->second)(dims);
+            return (gConvFactoryMemo[type] = h->second)(dims);
     // else, unhandled moves
         result = new NotImplementedConverter();
     }
@@ -3385,16 +3632,76 @@ void CPyCppyy::DestroyConverter(Converter* p)
         delete p;  // state-less converters are always shared
 }
 
+//----------------------------------------------------------------------------
+CPYCPPYY_EXPORT
+CPyCppyy::Converter* CPyCppyy::AcquireConverter(Cppyy::TCppType_t type)
+{
+// return the shared converter for type if available, otherwise create a new one,
+// which is shared from here on if it is shareable
+    BindingsLockGuard_t lock(gBindingsLock);
+    auto p = gConvPool.find(type);
+    if (p != gConvPool.end()) {
+        gConvPoolRefs[p->second].fRefCount += 1;
+        gConvPoolReferences += 1;
+        gConvPoolHits += 1;
+        return p->second;
+    }
+
+    Converter* cnv = CreateConverter(type);
+    if (cnv && cnv->HasState() && cnv->IsShareable()) {
+        gConvPool[type] = cnv;
+        gConvPoolRefs[cnv] = ConvPoolRef_t{type, 1};
+        gConvPoolReferences += 1;
+    }
+
+    return cnv;
+}
+
+//----------------------------------------------------------------------------
+CPYCPPYY_EXPORT
+void CPyCppyy::ReleaseConverter(Converter* p)
+{
+// release a converter from AcquireConverter(); converters not in the pool (which
+// includes all converters from CreateConverter()) are destroyed as usual
+    BindingsLockGuard_t lock(gBindingsLock);
+    auto r = p ? gConvPoolRefs.find(p) : gConvPoolRefs.end();
+    if (r == gConvPoolRefs.end()) {
+        DestroyConverter(p);
+        return;
+    }
+
+    gConvPoolReferences -= 1;
+    if (--r->second.fRefCount == 0) {
+        auto e = gConvPool.find(r->second.fType);
+        if (e != gConvPool.end() && e->second == p)
+            gConvPool.erase(e);
+        gConvPoolRefs.erase(r);
+        delete p;
+    }
+}
+
+//----------------------------------------------------------------------------
+CPYCPPYY_EXPORT
+CPyCppyy::ConverterPoolStats_t CPyCppyy::GetConverterPoolStats()
+{
+    BindingsLockGuard_t lock(gBindingsLock);
+    return ConverterPoolStats_t{gConvPoolRefs.size(), gConvPoolReferences, gConvPoolHits};
+}
+
 //----------------------------------------------------------------------------
 CPYCPPYY_EXPORT
 bool CPyCppyy::RegisterConverter(const std::string& name, cf_t fac)
 {
 // register a custom converter
+    BindingsLockGuard_t lock(gBindingsLock);
     auto f = gConvFactories.find(name);
     if (f != gConvFactories.end())
         return false;
 
     gConvFactories[name] = fac;
+    gConvFactoryMemo.clear();
+    gConvFactoryNameMemo.clear();
+    gConvPool.clear();        // shared converters in use stay alive until released
     return true;
 }
 
@@ -3403,9 +3710,13 @@ CPYCPPYY_EXPORT
 bool CPyCppyy::UnregisterConverter(const std::string& name)
 {
 // remove a custom converter
+    BindingsLockGuard_t lock(gBindingsLock);
     auto f = gConvFactories.find(name);
     if (f != gConvFactories.end()) {
         gConvFactories.erase(f);
+        gConvFactoryMemo.clear();
+        gConvFactoryNameMemo.clear();
+        gConvPool.clear();
         return true;
     }
     return false;
@@ -2,10 +2,13 @@
 #define CPYCPPYY_CONVERTERS_H
 
 // Bindings
+#include "CallContext.h"
 #include "Dimensions.h"
+#include "ProxyWrappers.h"
 
 // Standard
 #include <string>
+#include <typeinfo>
 
 
 namespace CPyCppyy {
@@ -22,6 +25,24 @@ public:
     virtual PyObject* FromMemory(void* address);
     virtual bool ToMemory(PyObject* value, void* address, PyObject* ctxt = nullptr);
     virtual bool HasState() { return false; }
+
+// converters whose state is fully set on construction (e.g. the class of an instance
+// argument) can be shared between all methods that take an argument of the same type;
+// converters with state opt in per concrete class (see IsExactly())
+    virtual bool IsShareable() { return !HasState(); }
+
+// estimate of SetArg() success, used in overload resolution before any call is made;
+// overrides must stay side-effect free (no exceptions, temporaries, python calls, or
+// context flags), as the estimate may be asked for any number of times, and must be
+// conservative, i.e. kMatchImpossible only if SetArg() is sure to fail; converters
+// that do not override it (such as most external ones) are always called
+    virtual EMatch CanConvert(PyObject*) { return kMatchUnknown; }
+
+protected:
+// for IsShareable(): true for an instance of T itself only, so that derived classes,
+// which may add state of their own (e.g. external ones), do not inherit sharing
+    template<typename T>
+    bool IsExactly() { return typeid(*this) == typeid(T); }
 };
 
 // create/destroy converter from fully qualified type (public API)
@@ -32,6 +53,18 @@ typedef Converter* (*cf_t)(cdims_t d);
 CPYCPPYY_EXPORT bool RegisterConverter(const std::string& name, cf_t fac);
 CPYCPPYY_EXPORT bool UnregisterConverter(const std::string& name);
 
+// shared converters for method arguments: shareable converters with state are created
+// once per type and reference counted, all others are as from CreateConverter()
+CPYCPPYY_EXPORT Converter* AcquireConverter(Cppyy::TCppType_t type);
+CPYCPPYY_EXPORT void ReleaseConverter(Converter* p);
+
+struct ConverterPoolStats_t {
+    size_t   fInstances;     // shared converters currently alive
+    size_t   fReferences;    // uses of shared converters, i.e. converters otherwise alive
+    uint64_t fHits;          // acquisitions served from the pool
+};
+CPYCPPYY_EXPORT ConverterPoolStats_t GetConverterPoolStats();
+
 
 // converters for special cases (only here b/c of external use of StrictInstancePtrConverter)
 class VoidArrayConverter : public Converter {
@@ -56,20 +89,23 @@ template <bool ISCONST>
 class InstancePtrConverter : public VoidArrayConverter {
 public:
     InstancePtrConverter(Cppyy::TCppType_t klass, bool keepControl = false) :
-        VoidArrayConverter(keepControl), fClass(klass) {}
+        VoidArrayConverter(keepControl), fClass(klass), fPyClass(klass) {}
 
 public:
     virtual bool SetArg(PyObject*, Parameter&, CallContext* = nullptr);
     virtual PyObject* FromMemory(void* address);
     virtual bool ToMemory(PyObject* value, void* address, PyObject* ctxt = nullptr);
+    virtual bool IsShareable() { return IsExactly<InstancePtrConverter>(); }
 
 protected:
     Cppyy::TCppType_t fClass;
+    PyClassRef        fPyClass;
 };
 
 class StrictInstancePtrConverter : public InstancePtrConverter<false> {
 public:
     using InstancePtrConverter<false>::InstancePtrConverter;
+    virtual bool IsShareable() { return IsExactly<StrictInstancePtrConverter>(); }
 
 protected:
     virtual bool GetAddressSpecialCase(PyObject*, void*&) { return false; }
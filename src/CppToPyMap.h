@@ -0,0 +1,223 @@
+#ifndef CPYCPPYY_CPPTOPYMAP_H
+#define CPYCPPYY_CPPTOPYMAP_H
+
+// Bindings
+#include "Threading.h"
+
+// Standard
+#include <stddef.h>
+#include <stdint.h>
+
+
+namespace CPyCppyy {
+
+/** Python proxies by C++ address, for tracking object identity (see MemoryRegulator)
+
+      An open addressing hash table with linear probing, keyed on the address of the
+      C++ object. Entries are a pair of pointers in a single array, so tracking an
+      object allocates nothing, except on the occasional resize, and the cost of a
+      lookup does not grow with the number of live objects. Deletion shifts back the
+      entries further down the same run, so there are no tombstones and probes stay
+      short under churn; a table that has become mostly empty is shrunk.
+
+      There is one table per C++ class, shared with its python-side derived classes,
+      each with its own lock (sharding tracking by class on free-threaded builds); the
+      lock is to be held for any access to the table. Usage statistics are kept per
+      table, under the same lock, and only summed over all tables when requested.
+ */
+
+class CppToPyMap_t {
+public:
+    struct Stats_t {
+        uint64_t fLive;              // objects tracked
+        uint64_t fLookups;           // finds, inserts, and erases
+        uint64_t fProbes;            // slots inspected by those lookups
+        uint64_t fMaxProbe;          // longest probe sequence seen
+    };
+
+public:
+    CppToPyMap_t() : fTable(nullptr), fMask(0), fSize(0), fStats{0, 0, 0, 0} {
+        LockGuard_t lock(sTablesMutex);
+        fPrev = nullptr;
+        fNext = sTables;
+        if (sTables) sTables->fPrev = this;
+        sTables = this;
+    }
+    CppToPyMap_t(const CppToPyMap_t&) = delete;
+    CppToPyMap_t& operator=(const CppToPyMap_t&) = delete;
+    ~CppToPyMap_t() {
+        {
+        // keep the counts of tables that go away in the totals
+            LockGuard_t lock(sTablesMutex);
+            sRetired.fLookups += fStats.fLookups;
+            sRetired.fProbes  += fStats.fProbes;
+            if (sRetired.fMaxProbe < fStats.fMaxProbe)
+                sRetired.fMaxProbe = fStats.fMaxProbe;
+            if (fPrev) fPrev->fNext = fNext;
+            else sTables = fNext;
+            if (fNext) fNext->fPrev = fPrev;
+        }
+        delete [] fTable;
+    }
+
+public:
+    size_t size() const { return fSize; }
+    size_t capacity() const { return fTable ? fMask+1 : 0; }
+
+// borrowed reference to the proxy tracking cppobj, or nullptr
+    PyObject* Find(Cppyy::TCppObject_t cppobj) {
+        size_t idx = 0;
+        Entry_t* entry = Lookup(cppobj, idx);
+        return entry ? entry->fPyObject : nullptr;
+    }
+
+// track cppobj by pyobj; returns the proxy that was tracking it before, if any
+    PyObject* Insert(Cppyy::TCppObject_t cppobj, PyObject* pyobj) {
+        if (!fTable || 7*(fMask+1) <= 10*(fSize+1))
+            Resize(fTable ? 2*(fMask+1) : kMinCapacity);
+
+        size_t idx = 0;
+        Entry_t* entry = Lookup(cppobj, idx);
+        if (entry) {
+            PyObject* old = entry->fPyObject;
+            entry->fPyObject = pyobj;
+            return old;
+        }
+
+    // lookup ended on the empty slot at the end of the run
+        fTable[idx] = Entry_t{cppobj, pyobj};
+        fSize += 1;
+        return nullptr;
+    }
+
+// stop tracking cppobj; returns the proxy that was tracking it, if any
+    PyObject* Erase(Cppyy::TCppObject_t cppobj) {
+        size_t hole = 0;
+        Entry_t* entry = Lookup(cppobj, hole);
+        if (!entry)
+            return nullptr;
+        PyObject* old = entry->fPyObject;
+
+    // shift back entries that would otherwise become unreachable
+        size_t idx = hole;
+        while (true) {
+            idx = (idx+1) & fMask;
+            if (!fTable[idx].fCppObject)
+                break;
+            size_t home = Home(fTable[idx].fCppObject);
+            if (((idx - home) & fMask) >= ((idx - hole) & fMask)) {
+                fTable[hole] = fTable[idx];
+                hole = idx;
+            }
+        }
+        fTable[hole] = Entry_t{nullptr, nullptr};
+        fSize -= 1;
+
+        if (kMinCapacity < fMask+1 && 8*fSize < fMask+1)
+            Resize((fMask+1)/2);
+
+        return old;
+    }
+
+// statistics of this table; the lock is to be held
+    Stats_t GetStats() const {
+        return Stats_t{fSize, fStats.fLookups, fStats.fProbes, fStats.fMaxProbe};
+    }
+
+// statistics summed over all tables, past and present (takes the table locks)
+    static Stats_t GetTotalStats() {
+        LockGuard_t lock(sTablesMutex);
+        Stats_t total = sRetired;
+        for (CppToPyMap_t* table = sTables; table; table = table->fNext) {
+            LockGuard_t tlock(table->fMutex);
+            total.fLive    += table->fSize;
+            total.fLookups += table->fStats.fLookups;
+            total.fProbes  += table->fStats.fProbes;
+            if (total.fMaxProbe < table->fStats.fMaxProbe)
+                total.fMaxProbe = table->fStats.fMaxProbe;
+        }
+        return total;
+    }
+
+public:
+    Mutex fMutex;
+
+private:
+    struct Entry_t {
+        Cppyy::TCppObject_t fCppObject;    // nullptr marks an empty slot
+        PyObject*           fPyObject;     // borrowed
+    };
+
+    static const size_t kMinCapacity = 16;
+
+    size_t Home(Cppyy::TCppObject_t cppobj) const {
+    // mix the pointer bits, as the low ones are mostly alignment
+        uint64_t h = (uint64_t)(uintptr_t)cppobj;
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdull;
+        h ^= h >> 33;
+        return (size_t)h & fMask;
+    }
+
+    Entry_t* Lookup(Cppyy::TCppObject_t cppobj, size_t& idx) {
+    // returns the entry for cppobj, if any; idx is left at its slot, or otherwise at
+    // the empty slot that ends the run (slot 0 if there is no table yet)
+        idx = 0;
+        if (!fTable)
+            return nullptr;
+
+        Entry_t* found = nullptr;
+        uint64_t nprobes = 1;
+        idx = Home(cppobj);
+        while (fTable[idx].fCppObject) {
+            if (fTable[idx].fCppObject == cppobj) {
+                found = &fTable[idx];
+                break;
+            }
+            idx = (idx+1) & fMask;
+            nprobes += 1;
+        }
+
+        fStats.fLookups += 1;
+        fStats.fProbes  += nprobes;
+        if (fStats.fMaxProbe < nprobes)
+            fStats.fMaxProbe = nprobes;
+
+        return found;
+    }
+
+    void Resize(size_t capacity) {
+        Entry_t* old = fTable;
+        size_t oldcap = old ? fMask+1 : 0;
+
+        fTable = new Entry_t[capacity]();
+        fMask = capacity-1;
+        for (size_t i = 0; i < oldcap; ++i) {
+            if (!old[i].fCppObject)
+                continue;
+            size_t idx = Home(old[i].fCppObject);
+            while (fTable[idx].fCppObject)
+                idx = (idx+1) & fMask;
+            fTable[idx] = old[i];
+        }
+        delete [] old;
+    }
+
+private:
+    Entry_t* fTable;
+    size_t   fMask;
+    size_t   fSize;
+    Stats_t  fStats;             // fLive unused, follows from fSize
+
+// all live tables, for the totals, and the summed counts of destroyed ones
+    CppToPyMap_t* fPrev;
+    CppToPyMap_t* fNext;
+
+    inline static CppToPyMap_t* sTables = nullptr;
+    inline static Stats_t       sRetired = {0, 0, 0, 0};
+    inline static Mutex         sTablesMutex;
+};
+
+} // namespace CPyCppyy
+
+#endif // !CPYCPPYY_CPPTOPYMAP_H
@@ -377,26 +377,72 @@ PyTypeObject IndexIter_Type = {
 
 static void vectoriter_dealloc(vectoriterobject* vi) {
     if (vi->vi_converter && vi->vi_converter->HasState()) delete vi->vi_converter;
+    Py_XDECREF(vi->vi_recycle[0]);
+    Py_XDECREF(vi->vi_recycle[1]);
     indexiter_dealloc(vi);
 }
 
+static int vectoriter_traverse(vectoriterobject* vi, visitproc visit, void* arg) {
+    Py_VISIT(vi->vi_recycle[0]);
+    Py_VISIT(vi->vi_recycle[1]);
+    return indexiter_traverse(vi, visit, arg);
+}
+
+static inline bool is_recyclable(PyObject* pyobj, Py_ssize_t nattrs) {
+// only a proxy that nobody else can observe can be re-pointed to another element
+    if (Py_REFCNT(pyobj) != 1)
+        return false;
+    Py_ssize_t wloff = Py_TYPE(pyobj)->tp_weaklistoffset;
+    if (wloff > 0 && *(PyObject**)((char*)pyobj + wloff))
+        return false;
+    uint32_t flags = ((CPPInstance*)pyobj)->fFlags;
+    if (!(flags & CPPInstance::kNoMemReg) || \
+            (flags & (CPPInstance::kIsOwner | CPPInstance::kIsExtended | CPPInstance::kIsRegulated)))
+        return false;
+
+// attributes set on an element (other than the life line, nattrs) would show up on
+// the next one, so such a proxy is not re-used
+    PyObject** dictptr = _PyObject_GetDictPtr(pyobj);
+    return !dictptr || !*dictptr || PyDict_GET_SIZE(*dictptr) <= nattrs;
+}
+
+static PyObject* iter_element(vectoriterobject* vi, void* location) {
+    if (vi->vi_converter)
+        return vi->vi_converter->FromMemory(location);
+
+// The CPPInstance::kNoMemReg by-passes the memory regulator; the assumption here is
+// that objects in containers are simple and thus do not need to maintain object identity
+// (or at least not during the loop anyway). This gains 2x in performance. Further, the
+// proxy returned two steps ago (the one before is typically still held by the loop
+// variable) is re-used if it was dropped, saving its allocation and life line.
+    PyObject*& recycle = vi->vi_recycle[vi->ii_pos & 1];
+    if (recycle && is_recyclable(recycle, (vi->vi_flags & vectoriterobject::kNeedLifeLine) ? 1 : 0)) {
+        ((CPPInstance*)recycle)->Set(location);
+        Py_INCREF(recycle);
+        return recycle;
+    }
+
+    PyObject* result = CPyCppyy::BindCppObjectNoCast(location, vi->vi_klass, CPyCppyy::CPPInstance::kNoMemReg);
+    if ((vi->vi_flags & vectoriterobject::kNeedLifeLine) && result)
+        PyObject_SetAttr(result, PyStrings::gLifeLine, vi->ii_container);
+
+    if (result) {
+        Py_XDECREF(recycle);
+        Py_INCREF(result);
+        recycle = result;
+    }
+    return result;
+}
+
 static PyObject* vectoriter_iternext(vectoriterobject* vi) {
     if (vi->ii_pos >= vi->ii_len)
         return nullptr;
 
     PyObject* result = nullptr;
 
-    if (vi->vi_data && vi->vi_converter) {
+    if (vi->vi_data && (vi->vi_converter || vi->vi_klass)) {
         void* location = (void*)((ptrdiff_t)vi->vi_data + vi->vi_stride * vi->ii_pos);
-        result = vi->vi_converter->FromMemory(location);
-    } else if (vi->vi_data && vi->vi_klass) {
-    // The CPPInstance::kNoMemReg by-passes the memory regulator; the assumption here is
-    // that objects in vectors are simple and thus do not need to maintain object identity
-    // (or at least not during the loop anyway). This gains 2x in performance.
-        Cppyy::TCppObject_t cppobj = (Cppyy::TCppObject_t)((ptrdiff_t)vi->vi_data + vi->vi_stride * vi->ii_pos);
-        result = CPyCppyy::BindCppObjectNoCast(cppobj, vi->vi_klass, CPyCppyy::CPPInstance::kNoMemReg);
-        if ((vi->vi_flags & vectoriterobject::kNeedLifeLine) && result)
-            PyObject_SetAttr(result, PyStrings::gLifeLine, vi->ii_container);
+        result = iter_element(vi, location);
     } else {
         PyObject* pyindex = PyLong_FromSsize_t(vi->ii_pos);
         result = PyObject_CallMethodOneArg((PyObject*)vi->ii_container, PyStrings::gGetNoCheck, pyindex);
@@ -417,7 +463,7 @@ PyTypeObject VectorIter_Type = {
     Py_TPFLAGS_DEFAULT |
         Py_TPFLAGS_HAVE_GC,       // tp_flags
     0,
-    (traverseproc)indexiter_traverse,  // tp_traverse
+    (traverseproc)vectoriter_traverse, // tp_traverse
     0, 0, 0,
     PyObject_SelfIter,            // tp_iter
     (iternextfunc)vectoriter_iternext,      // tp_iternext
@@ -433,4 +479,60 @@ PyTypeObject VectorIter_Type = {
 #endif
 };
 
+
+static void stliter_dealloc(stliterobject* si) {
+    if (si->si_step && si->si_state)
+        si->si_step(nullptr, &si->si_state, nullptr);
+    vectoriter_dealloc(si);
+}
+
+static PyObject* stliter_iternext(stliterobject* si) {
+// elements are stepped over one at a time (rather than collected in chunks), so that
+// erasing an element that was already returned can not leave dangling addresses
+    if (!si->si_step)
+        return nullptr;
+
+    void* cont = ((CPPInstance*)si->ii_container)->GetObject();
+    void* location = nullptr;
+    int stat = cont ? si->si_step(cont, &si->si_state, &location) : 0;
+    if (stat != 1) {
+        if (si->si_state)
+            si->si_step(nullptr, &si->si_state, nullptr);
+        si->si_step = nullptr;            // exhausted or invalidated
+        if (stat < 0)
+            PyErr_SetString(PyExc_RuntimeError, "container changed size during iteration");
+        return nullptr;
+    }
+
+    PyObject* result = iter_element(si, location);
+    si->ii_pos += 1;                      // for vi_recycle alternation only
+    return result;
+}
+
+PyTypeObject STLIter_Type = {
+    PyVarObject_HEAD_INIT(&PyType_Type, 0)
+    (char*)"cppyy.stliter",       // tp_name
+    sizeof(stliterobject),        // tp_basicsize
+    0,
+    (destructor)stliter_dealloc,       // tp_dealloc
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    Py_TPFLAGS_DEFAULT |
+        Py_TPFLAGS_HAVE_GC,       // tp_flags
+    0,
+    (traverseproc)vectoriter_traverse, // tp_traverse
+    0, 0, 0,
+    PyObject_SelfIter,            // tp_iter
+    (iternextfunc)stliter_iternext,    // tp_iternext
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+#if PY_VERSION_HEX >= 0x02030000
+    , 0                           // tp_del
+#endif
+#if PY_VERSION_HEX >= 0x02060000
+    , 0                           // tp_version_tag
+#endif
+#if PY_VERSION_HEX >= 0x03040000
+    , 0                           // tp_finalize
+#endif
+};
+
 } // namespace CPyCppyy
@@ -98,6 +98,7 @@ struct vectoriterobject : public indexiterobject {
     CPyCppyy::Converter*     vi_converter;
     Cppyy::TCppType_t        vi_klass;
     int                      vi_flags;
+    PyObject*                vi_recycle[2];    // earlier results, for re-use of proxies
 
     enum EFlags {
         kDefault        = 0x0000,
@@ -107,6 +108,20 @@ struct vectoriterobject : public indexiterobject {
 
 extern PyTypeObject VectorIter_Type;
 
+//- custom iterator for STL containers, stepping C++ iterators natively ------
+// the step function advances the C++ iterator held in state (created on first use)
+// over the container by one element, storing its address; it returns 1 on success,
+// 0 at the end, and -1 if the container changed size since the iterator was created
+// (which may have invalidated it); with a null container, it deletes the iterator
+typedef int (*stliterstep_t)(void* container, void** state, void** address);
+
+struct stliterobject : public vectoriterobject {
+    stliterstep_t            si_step;
+    void*                    si_state;
+};
+
+extern PyTypeObject STLIter_Type;
+
 } // namespace CPyCppyy
 
 #endif // !CPYCPPYY_CUSTOMPYTYPES_H
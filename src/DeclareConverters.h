@@ -20,12 +20,14 @@ public:                                                                      \
     virtual bool SetArg(PyObject*, Parameter&, CallContext* = nullptr);      \
     virtual PyObject* FromMemory(void*);                                     \
     virtual bool ToMemory(PyObject*, void*, PyObject* = nullptr);            \
+    virtual EMatch CanConvert(PyObject*);                                    \
 };                                                                           \
                                                                              \
 class Const##name##RefConverter : public Converter {                         \
 public:                                                                      \
     virtual bool SetArg(PyObject*, Parameter&, CallContext* = nullptr);      \
     virtual PyObject* FromMemory(void*);                                     \
+    virtual EMatch CanConvert(PyObject*);                                    \
 }
 
 
@@ -40,6 +42,7 @@ class Const##name##RefConverter : public Converter {                         \
 public:                                                                      \
     virtual bool SetArg(PyObject*, Parameter&, CallContext* = nullptr);      \
     virtual PyObject* FromMemory(void*);                                     \
+    virtual EMatch CanConvert(PyObject*);                                    \
 }
 
 #define CPPYY_DECLARE_REFCONVERTER(name)                                     \
@@ -247,20 +250,23 @@ public:
     virtual bool SetArg(PyObject*, Parameter&, CallContext* = nullptr);
     virtual PyObject* FromMemory(void*);
     virtual bool ToMemory(PyObject*, void*, PyObject* = nullptr);
+    virtual bool IsShareable() { return IsExactly<InstanceConverter>(); }
 };
 
 class InstanceRefConverter : public Converter  {
 public:
     InstanceRefConverter(Cppyy::TCppType_t klass, bool isConst) :
-        fClass(klass), fIsConst(isConst) {}
+        fClass(klass), fPyClass(klass), fIsConst(isConst) {}
 
 public:
     virtual bool SetArg(PyObject*, Parameter&, CallContext* = nullptr);
     virtual PyObject* FromMemory(void* address);
     virtual bool HasState() { return true; }
+    virtual bool IsShareable() { return IsExactly<InstanceRefConverter>(); }
 
 protected:
     Cppyy::TCppType_t fClass;
+    PyClassRef        fPyClass;
     bool fIsConst;
 };
 
@@ -268,6 +274,7 @@ class InstanceMoveConverter : public InstanceRefConverter  {
 public:
     InstanceMoveConverter(Cppyy::TCppType_t klass) : InstanceRefConverter(klass, true) {}
     virtual bool SetArg(PyObject*, Parameter&, CallContext* = nullptr);
+    virtual bool IsShareable() { return IsExactly<InstanceMoveConverter>(); }
 };
 
 template <bool ISREFERENCE>
@@ -279,6 +286,7 @@ public:
     virtual bool SetArg(PyObject*, Parameter&, CallContext* = nullptr);
     virtual PyObject* FromMemory(void* address);
     virtual bool ToMemory(PyObject* value, void* address, PyObject* = nullptr);
+    virtual bool IsShareable() { return IsExactly<InstancePtrPtrConverter>(); }
 };
 
 class InstanceArrayConverter : public InstancePtrConverter<false> {
@@ -385,6 +393,7 @@ public:
     virtual PyObject* FromMemory(void* address);
     virtual bool ToMemory(PyObject*, void*, PyObject* = nullptr);
     virtual bool HasState() { return true; }
+    virtual bool IsShareable() { return IsExactly<FunctionPointerConverter>(); }
 
 protected:
     std::string fRetType;
@@ -425,6 +434,7 @@ public:
     virtual PyObject* FromMemory(void* address);
     //virtual bool ToMemory(PyObject*, void*, PyObject* = nullptr);
     virtual bool HasState() { return true; }
+    virtual bool IsShareable() { return IsExactly<SmartPtrConverter>(); }
 
 protected:
     virtual bool GetAddressSpecialCase(PyObject*, void*&) { return false; }
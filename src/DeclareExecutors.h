@@ -5,6 +5,7 @@
 #include "Executors.h"
 #include "CallContext.h"
 #include "Dimensions.h"
+#include "ProxyWrappers.h"
 
 // Standard
 #if __cplusplus > 201402L
@@ -60,6 +61,7 @@ public:                                                                      \
     virtual PyObject* Execute(                                               \
         Cppyy::TCppMethod_t, Cppyy::TCppObject_t, CallContext*);             \
     virtual bool HasState() { return true; }                                 \
+    virtual bool IsShareable() { return true; }                              \
 }
 CPPYY_ARRAY_DECL_EXEC(Void);
 CPPYY_ARRAY_DECL_EXEC(Bool);
@@ -91,13 +93,15 @@ CPPYY_DECL_EXEC(STLWString);
 
 class InstancePtrExecutor : public Executor {
 public:
-    InstancePtrExecutor(Cppyy::TCppType_t klass) : fClass(klass) {}
+    InstancePtrExecutor(Cppyy::TCppType_t klass) : fClass(klass), fPyClass(klass) {}
     virtual PyObject* Execute(
         Cppyy::TCppMethod_t, Cppyy::TCppObject_t, CallContext*);
     virtual bool HasState() { return true; }
+    virtual bool IsShareable() { return true; }
 
 protected:
     Cppyy::TCppScope_t fClass;
+    PyClassRef         fPyClass;
 };
 
 class InstanceExecutor : public Executor {
@@ -106,10 +110,13 @@ public:
     virtual PyObject* Execute(
         Cppyy::TCppMethod_t, Cppyy::TCppObject_t, CallContext*);
     virtual bool HasState() { return true; }
+    virtual bool IsShareable() { return true; }
 
 protected:
     Cppyy::TCppScope_t fClass;
+    PyClassRef         fPyClass;
     uint32_t           fFlags;
+    int                fInlineSize;     // > 0 if results are held inline, < 0 if unknown
 };
 
 class IteratorExecutor : public InstanceExecutor {
@@ -149,12 +156,13 @@ CPPYY_DECL_REFEXEC(STLString);
 // special cases
 class InstanceRefExecutor : public RefExecutor {
 public:
-    InstanceRefExecutor(Cppyy::TCppScope_t klass) : fClass(klass) {}
+    InstanceRefExecutor(Cppyy::TCppScope_t klass) : fClass(klass), fPyClass(klass) {}
     virtual PyObject* Execute(
         Cppyy::TCppMethod_t, Cppyy::TCppObject_t, CallContext*);
 
 protected:
     Cppyy::TCppScope_t fClass;
+    PyClassRef         fPyClass;
 };
 
 class InstancePtrPtrExecutor : public InstanceRefExecutor {
@@ -0,0 +1,155 @@
+// Bindings
+#include "CPyCppyy.h"
+#include "DispatchCache.h"
+
+// Standard
+#include <algorithm>
+
+
+//- private helpers ----------------------------------------------------------
+const CPyCppyy::DispatchCache::Resolution_t* CPyCppyy::DispatchCache::FindSlow_(CPyCppyy_PyArgs_t args, size_t nargsf)
+{
+// probe the table for the exact signature of args; load factor is kept below 1/2,
+// so there is always an empty slot to terminate the probe sequence
+    if (fSize) {
+        const uint64_t key = HashSignature(args, nargsf);
+        const size_t mask = fCapacity-1;
+        for (size_t i = Slot_(key); fTable[i].fResolution.fCallable; i = (i+1) & mask) {
+            Entry_t& e = fTable[i];
+            if (e.fKey != key)
+                continue;
+
+            if (!MatchSignature(e.fSig, e.fNArgs, args, nargsf)) {
+                fStats.fCollisions += 1;
+                continue;
+            }
+
+            e.fLastUse = ++fClock;
+            fLast = &e;
+            fStats.fHits += 1;
+            return &e.fResolution;
+        }
+    }
+
+    fStats.fMisses += 1;
+    return nullptr;
+}
+
+//----------------------------------------------------------------------------
+void CPyCppyy::DispatchCache::Place_(const Entry_t& entry)
+{
+// store a new entry in the first free slot of its probe sequence (the signature
+// is known not to be in the table yet)
+    const size_t mask = fCapacity-1;
+    size_t i = Slot_(entry.fKey);
+    while (fTable[i].fResolution.fCallable)
+        i = (i+1) & mask;
+
+    fTable[i] = entry;
+    fLast = &fTable[i];
+    fSize += 1;
+}
+
+//----------------------------------------------------------------------------
+void CPyCppyy::DispatchCache::Grow_()
+{
+// double the table (tables start small, as most overload sets see few signatures)
+    Entry_t* old = fTable;
+    size_t oldcap = fCapacity;
+
+    fCapacity = oldcap ? 2*oldcap : 8;
+    fTable = new Entry_t[fCapacity]();
+    fSize = 0;
+
+    for (size_t i = 0; i < oldcap; ++i) {
+        if (old[i].fResolution.fCallable)
+            Place_(old[i]);           // moves ownership of the signature
+    }
+    fLast = nullptr;
+
+    delete [] old;
+}
+
+//----------------------------------------------------------------------------
+void CPyCppyy::DispatchCache::EvictLRU_()
+{
+// drop the least recently used entry; the probe chain is repaired by shifting
+// later entries back (no tombstones, so lookups never slow down with churn)
+    const size_t mask = fCapacity-1;
+
+    size_t hole = fCapacity;
+    for (size_t i = 0; i < fCapacity; ++i) {
+        if (fTable[i].fResolution.fCallable && (hole == fCapacity || fTable[i].fLastUse < fTable[hole].fLastUse))
+            hole = i;
+    }
+    if (hole == fCapacity)
+        return;
+
+    delete [] fTable[hole].fSig;
+
+    for (size_t i = (hole+1) & mask; fTable[i].fResolution.fCallable; i = (i+1) & mask) {
+    // an entry can fill the hole only if its home slot does not lie in (hole, i]
+        size_t home = Slot_(fTable[i].fKey);
+        if (((i - home) & mask) >= ((i - hole) & mask)) {
+            fTable[hole] = fTable[i];
+            hole = i;
+        }
+    }
+    fTable[hole].fResolution.fCallable = nullptr;
+    fTable[hole].fSig = nullptr;
+
+    fLast = nullptr;
+    fSize -= 1;
+    fStats.fEvictions += 1;
+}
+
+
+//- public members -----------------------------------------------------------
+void CPyCppyy::DispatchCache::Insert(const Signature_t& sig, const Resolution_t& res)
+{
+// memoize the resolution (with the overload that succeeded) for the given signature
+    LockGuard_t lock(fMutex);
+    const uint64_t key = HashSignature(sig);
+    if (fSize) {
+        const size_t mask = fCapacity-1;
+        for (size_t i = Slot_(key); fTable[i].fResolution.fCallable; i = (i+1) & mask) {
+            Entry_t& e = fTable[i];
+            if (e.fKey != key || e.fNArgs != sig.size() || !std::equal(sig.begin(), sig.end(), e.fSig))
+                continue;
+
+        // debatable: two overloads accept the same signature (e.g. depending on the
+        // argument values) and preferring the latest may result in "ping pong"
+            if (e.fResolution.fCallable != res.fCallable)
+                fStats.fReplacements += 1;
+            e.fResolution = res;
+            e.fLastUse = ++fClock;
+            fLast = &e;
+            return;
+        }
+    }
+
+    if (CPYCPPYY_DISPATCH_MAXENTRIES <= fSize)
+        EvictLRU_();
+
+    if (fCapacity < 2*(fSize+1))
+        Grow_();
+
+    uintptr_t* items = new uintptr_t[sig.size() ? sig.size() : 1];
+    std::copy(sig.begin(), sig.end(), items);
+    Place_(Entry_t{key, res, ++fClock, items, sig.size()});
+}
+
+//----------------------------------------------------------------------------
+void CPyCppyy::DispatchCache::Clear()
+{
+// forget all memoized signatures (statistics are kept)
+    LockGuard_t lock(fMutex);
+    for (size_t i = 0; i < fCapacity; ++i)
+        delete [] fTable[i].fSig;
+    delete [] fTable;
+
+    fTable    = nullptr;
+    fLast     = nullptr;
+    fCapacity = 0;
+    fSize     = 0;
+}
@@ -0,0 +1,188 @@
+#ifndef CPYCPPYY_DISPATCHCACHE_H
+#define CPYCPPYY_DISPATCHCACHE_H
+
+// Bindings
+#include "Threading.h"
+
+// Standard
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+
+namespace CPyCppyy {
+
+class PyCallable;
+
+// Exact signature of a call: one word per argument, holding its type pointer, with
+// the lowest bit (always zero in an aligned pointer) set if the argument is eligible
+// for a move, i.e. only referenced by the call itself.
+typedef std::vector<uintptr_t> Signature_t;
+
+inline uintptr_t SignatureItem(PyObject* pyobj)
+{
+    return (uintptr_t)Py_TYPE(pyobj) | (uintptr_t)(Py_REFCNT(pyobj) == 1 ? 1 : 0);
+}
+
+inline Signature_t MakeSignature(CPyCppyy_PyArgs_t args, size_t nargsf)
+{
+    Py_ssize_t nargs = CPyCppyy_PyArgs_GET_SIZE(args, nargsf);
+    Signature_t sig; sig.reserve(nargs);
+    for (Py_ssize_t i = 0; i < nargs; ++i)
+        sig.push_back(SignatureItem(CPyCppyy_PyArgs_GET_ITEM(args, i)));
+    return sig;
+}
+
+inline bool MatchSignature(const uintptr_t* sig, size_t nsig, CPyCppyy_PyArgs_t args, size_t nargsf)
+{
+    if ((size_t)CPyCppyy_PyArgs_GET_SIZE(args, nargsf) != nsig)
+        return false;
+    for (size_t i = 0; i < nsig; ++i) {
+        if (sig[i] != SignatureItem(CPyCppyy_PyArgs_GET_ITEM(args, i)))
+            return false;
+    }
+    return true;
+}
+
+inline bool MatchSignature(const Signature_t& sig, CPyCppyy_PyArgs_t args, size_t nargsf)
+{
+    return MatchSignature(sig.data(), sig.size(), args, nargsf);
+}
+
+// signature hashes only select a bucket; matches are always verified on the exact signature
+inline uint64_t HashSignatureItem(uint64_t hash, uintptr_t item)
+{
+    hash += (uint64_t)item;
+    hash += (hash << 10); hash ^= (hash >> 6);
+    return hash;
+}
+
+inline uint64_t HashSignatureFinal(uint64_t hash)
+{
+    hash += (hash << 3); hash ^= (hash >> 11); hash += (hash << 15);
+    return hash;
+}
+
+inline uint64_t HashSignature(CPyCppyy_PyArgs_t args, size_t nargsf)
+{
+// Build a hash from the types of the given python function arguments.
+    uint64_t hash = 0;
+    Py_ssize_t nargs = CPyCppyy_PyArgs_GET_SIZE(args, nargsf);
+    for (Py_ssize_t i = 0; i < nargs; ++i)
+        hash = HashSignatureItem(hash, SignatureItem(CPyCppyy_PyArgs_GET_ITEM(args, i)));
+    return HashSignatureFinal(hash);
+}
+
+inline uint64_t HashSignature(const Signature_t& sig)
+{
+    uint64_t hash = 0;
+    for (auto item : sig)
+        hash = HashSignatureItem(hash, item);
+    return HashSignatureFinal(hash);
+}
+
+
+// upper limit on the number of memoized signatures per overload set; beyond this,
+// the least recently used signature is evicted
+#ifndef CPYCPPYY_DISPATCH_MAXENTRIES
+#define CPYCPPYY_DISPATCH_MAXENTRIES 32
+#endif
+
+/** Signature -> overload memoization for overloaded methods
+
+      Small open-addressing table (linear probing, backward-shift deletion) keyed
+      on the exact signature of the call arguments, with the signature hash used
+      to select the bucket. The most recent hit is kept as an inline cache, to be
+      checked before hashing and probing. Resolutions are copied out under the lock
+      of the cache, which is only taken during lookup and update.
+ */
+
+class DispatchCache {
+public:
+    struct Stats_t {
+        uint64_t fHits;          // signature found, memoized overload returned
+        uint64_t fMisses;        // signature unknown, full resolution needed
+        uint64_t fCollisions;    // equal hashes, but different signatures
+        uint64_t fReplacements;  // memoized overload replaced by another one
+        uint64_t fEvictions;     // least recently used entries dropped
+        uint64_t fSkips;         // overload attempts avoided on known or estimated failures
+    };
+
+// Outcome of overload resolution for a signature. Besides the overload that succeeded,
+// the overloads that failed are remembered (by index into the sorted overloads; only
+// the first 64 are tracked), to be skipped when the signature needs resolving again,
+// which happens if the memoized overload fails on the argument values.
+    struct Resolution_t {
+        PyCallable* fCallable;   // overload that succeeded; nullptr marks an empty slot
+        uint64_t    fRejected;   // overloads that could not convert the arguments
+        uint64_t    fImplicit;   // overloads that need implicit conversions
+    };
+
+    static uint64_t MethodBit(size_t imeth) {
+        return imeth < 64 ? (uint64_t)1 << imeth : 0;
+    }
+
+public:
+    DispatchCache() : fTable(nullptr), fLast(nullptr), fCapacity(0), fSize(0),
+        fClock(0), fStats{0, 0, 0, 0, 0, 0} {}
+    DispatchCache(const DispatchCache&) = delete;
+    DispatchCache& operator=(const DispatchCache&) = delete;
+    ~DispatchCache() { Clear(); }
+
+public:
+    bool Find(CPyCppyy_PyArgs_t args, size_t nargsf, Resolution_t& res) {
+        LockGuard_t lock(fMutex);
+    // inline cache first: repeated calls with the same signature are the norm
+        Entry_t* e = fLast;
+        if (e && MatchSignature(e->fSig, e->fNArgs, args, nargsf)) {
+            e->fLastUse = ++fClock;
+            fStats.fHits += 1;
+            res = e->fResolution;
+            return true;
+        }
+        const Resolution_t* found = FindSlow_(args, nargsf);
+        if (found) res = *found;
+        return (bool)found;
+    }
+
+    void Insert(const Signature_t& sig, const Resolution_t& res);
+    void Clear();
+
+    void RecordSkip() { LockGuard_t lock(fMutex); fStats.fSkips += 1; }
+    void ResetStats() { LockGuard_t lock(fMutex); fStats = Stats_t{0, 0, 0, 0, 0, 0}; }
+
+    Stats_t GetStats() { LockGuard_t lock(fMutex); return fStats; }
+    size_t GetSize() const { return fSize; }
+    size_t GetCapacity() const { return fCapacity; }
+
+private:
+    struct Entry_t {
+        uint64_t     fKey;          // signature hash
+        Resolution_t fResolution;
+        uint64_t     fLastUse;
+        uintptr_t*   fSig;          // exact signature, owned
+        size_t       fNArgs;
+    };
+
+    size_t Slot_(uint64_t key) const {
+        return (size_t)((key * 0x9E3779B97F4A7C15ull) >> 32) & (fCapacity-1);
+    }
+
+    const Resolution_t* FindSlow_(CPyCppyy_PyArgs_t args, size_t nargsf);
+    void Grow_();
+    void EvictLRU_();
+    void Place_(const Entry_t& entry);
+
+private:
+    Entry_t* fTable;
+    Entry_t* fLast;
+    size_t   fCapacity;
+    size_t   fSize;
+    uint64_t fClock;
+    Stats_t  fStats;
+    Mutex    fMutex;
+};
+
+} // namespace CPyCppyy
+
+#endif // !CPYCPPYY_DISPATCHCACHE_H
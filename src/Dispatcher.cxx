@@ -8,10 +8,32 @@
 #include "Utility.h"
 
 // Standard
+#include <map>
 #include <set>
 #include <sstream>
 
 
+//----------------------------------------------------------------------------
+static inline void DeclareMethodName(const std::string& mtCppName, std::ostringstream& code)
+{
+// declare the interned method name, created on first use (CPYCPPYY_STATIC is empty on
+// Windows, see ReleaseMethodName)
+#if PY_VERSION_HEX < 0x03000000
+    code << "    CPYCPPYY_STATIC PyObject* mtPyName = PyString_InternFromString(\"" << mtCppName << "\");\n";
+#else
+    code << "    CPYCPPYY_STATIC PyObject* mtPyName = PyUnicode_InternFromString(\"" << mtCppName << "\");\n";
+#endif
+}
+
+static inline void ReleaseMethodName(std::ostringstream& code)
+{
+#ifdef _WIN32
+    code << "    Py_DECREF(mtPyName);\n";
+#else
+    (void)code;
+#endif
+}
+
 //----------------------------------------------------------------------------
 static inline void InjectMethod(Cppyy::TCppMethod_t method, const std::string& mtCppName, std::ostringstream& code)
 {
@@ -37,16 +59,26 @@ static inline void InjectMethod(Cppyy::TCppMethod_t method, const std::string& m
 // start function body
     Utility::ConstructCallbackPreamble(retType, argtypes, code);
 
-// perform actual method call
-#if PY_VERSION_HEX < 0x03000000
-    code << "    PyObject* mtPyName = PyString_FromString(\"" << mtCppName << "\");\n" // TODO: intern?
+// perform actual method call; method resolution goes through the interpreter's cache of
+// type lookups (keyed by the type's version tag, so invalidated on class changes), with
+// the callable then called with self in front, without creating a bound method
+    DeclareMethodName(mtCppName, code);
+#if PY_VERSION_HEX >= 0x03090000
+// (a default constructed DispatchPtr, e.g. in an STL container, holds no python object)
+    code << "    pyargs[0] = (PyObject*)_internal_self;\n"
+            "    PyObject* pyresult = NULL;\n"
+            "    if (!pyargs[0])\n"
+            "      PyErr_SetString(PyExc_ReferenceError, \"no python object bound to dispatcher\");\n"
+            "    else\n"
+            "      pyresult = PyObject_VectorcallMethod(mtPyName, pyargs, "
+         << nArgs+1 << " | PY_VECTORCALL_ARGUMENTS_OFFSET, NULL);\n";
 #else
-    code << "    PyObject* mtPyName = PyUnicode_FromString(\"" << mtCppName << "\");\n"
-#endif
-            "    PyObject* pyresult = PyObject_CallMethodObjArgs((PyObject*)_internal_self, mtPyName";
+    code << "    PyObject* pyresult = PyObject_CallMethodObjArgs((PyObject*)_internal_self, mtPyName";
     for (Cppyy::TCppIndex_t i = 0; i < nArgs; ++i)
-        code << ", pyargs[" << i << "]";
-    code << ", NULL);\n    Py_DECREF(mtPyName);\n";
+        code << ", pyargs[" << i+1 << "]";
+    code << ", NULL);\n";
+#endif
+    ReleaseMethodName(code);
 
 // close
     Utility::ConstructCallbackReturn(retType, nArgs, code);
@@ -66,6 +98,29 @@ namespace {
     typedef std::vector<Cppyy::TCppMethod_t> Ctors_t;
     typedef std::vector<Ctors_t> AllCtors_t;
     typedef std::vector<std::pair<Cppyy::TCppMethod_t, size_t>> CtorInfos_t;
+
+// Generated dispatchers forward to the python object by method name, so python classes
+// with the same bases that override the same methods can share one. They are cached
+// both by the callables in the class dictionary, which is known up front, and by the
+// methods actually overridden, which is known only after scanning the bases.
+    struct DispatcherInfo_t {
+        Cppyy::TCppScope_t    fScope;
+        std::set<std::string> fProtectedNames;
+    };
+    typedef std::map<std::string, DispatcherInfo_t> DispatcherCache_t;
+    static DispatcherCache_t gDispatchers;
+
+    std::string DispatcherKey(Cppyy::TCppScope_t klass, const BaseInfos_t& base_infos,
+        const std::set<std::string>& names, char kind)
+    {
+        std::ostringstream key;
+        key << kind << (intptr_t)klass;
+        for (const auto& binfo : base_infos)
+            key << ':' << (intptr_t)binfo.btype;
+        for (const auto& name : names)
+            key << '|' << name;
+        return key.str();
+    }
 } // unnamed namespace
 
 static void build_constructors(
@@ -145,6 +200,9 @@ std::vector<TCppMethod_t> FindBaseMethod(TCppScope_t tbase, const std::string mt
 
 } // unnamed namespace
 
+static bool SetupDispatcher(CPyCppyy::CPPScope* klass, Cppyy::TCppScope_t disp,
+    const std::set<std::string>& protected_names, std::ostringstream& err);
+
 bool CPyCppyy::InsertDispatcher(CPPScope* klass, PyObject* bases, PyObject* dct, std::ostringstream& err)
 {
 // Scan all methods in dct and where it overloads base methods in klass, create
@@ -191,8 +249,34 @@ bool CPyCppyy::InsertDispatcher(CPPScope* klass, PyObject* bases, PyObject* dct,
 // TODO: check deep hierarchy for multiple inheritance
     bool isDeepHierarchy = klass->fCppType && base_infos.front().btype != klass->fCppType;
 
-// once classes can be extended, should consider re-use; for now, since derived
-// python classes can differ in what they override, simply use different shims
+// methods: first collect all callables, then get overrides from base classes, for
+// those that are still missing, search the hierarchy
+    PyObject* clbs = PyDict_New();
+    std::set<std::string> clbs_names;
+    PyObject* items = PyDict_Items(dct);
+    for (Py_ssize_t i = 0; i < PyList_GET_SIZE(items); ++i) {
+        PyObject* value = PyTuple_GET_ITEM(PyList_GET_ITEM(items, i), 1);
+        if (PyCallable_Check(value)) {
+            PyObject* key = PyTuple_GET_ITEM(PyList_GET_ITEM(items, i), 0);
+            PyDict_SetItem(clbs, key, value);
+            if (CPyCppyy_PyText_Check(key))
+                clbs_names.insert(CPyCppyy_PyText_AsString(key));
+        }
+    }
+    Py_DECREF(items);
+    if (PyDict_DelItem(clbs, PyStrings::gInit) != 0)
+        PyErr_Clear();
+    clbs_names.erase("__init__");
+
+// re-use a dispatcher if one was created for the same bases and python callables
+    const std::string& clbs_key = DispatcherKey(klass->fCppType, base_infos, clbs_names, 'c');
+    auto cached = gDispatchers.find(clbs_key);
+    if (cached != gDispatchers.end()) {
+        Py_DECREF(clbs);
+        return SetupDispatcher(klass, cached->second.fScope, cached->second.fProtectedNames, err);
+    }
+
+// new dispatcher (python classes overriding the same methods share it, see above)
     static int counter = 0;
     std::ostringstream osname;
     osname << "Dispatcher" << ++counter;
@@ -217,10 +301,20 @@ bool CPyCppyy::InsertDispatcher(CPPScope* klass, PyObject* bases, PyObject* dct,
 // the conventional __destruct__ method (note that __del__ is always called, too, if
 // provided, but only when the Python object goes away)
     if (PyMapping_HasKeyString(dct, (char*)"__destruct__")) {
-        code << "  virtual ~" << derivedName << "() {\n"
-                "    PyObject* mtPyName = PyUnicode_FromString(\"__destruct__\");\n"
-                "    PyObject* pyresult = PyObject_CallMethodObjArgs((PyObject*)_internal_self, mtPyName, NULL);\n"
-                "    Py_DECREF(mtPyName);\n";
+        code << "  virtual ~" << derivedName << "() {\n";
+        DeclareMethodName("__destruct__", code);
+#if PY_VERSION_HEX >= 0x03090000
+        code << "    PyObject* pyself = (PyObject*)_internal_self;\n"
+                "    PyObject* pyresult = NULL;\n"
+                "    if (!pyself)\n"
+                "      PyErr_SetString(PyExc_ReferenceError, \"no python object bound to dispatcher\");\n"
+                "    else\n"
+                "      pyresult = PyObject_VectorcallMethod(mtPyName, &pyself, "
+                    "1 | PY_VECTORCALL_ARGUMENTS_OFFSET, NULL);\n";
+#else
+        code << "    PyObject* pyresult = PyObject_CallMethodObjArgs((PyObject*)_internal_self, mtPyName, NULL);\n";
+#endif
+        ReleaseMethodName(code);
 
     // this being a destructor, print on exception rather than propagate using the
     // magic C++ exception ...
@@ -230,23 +324,15 @@ bool CPyCppyy::InsertDispatcher(CPPScope* klass, PyObject* bases, PyObject* dct,
     } else
         code << "  virtual ~" << derivedName << "() {}\n";
 
-// methods: first collect all callables, then get overrides from base classes, for
-// those that are still missing, search the hierarchy
-    PyObject* clbs = PyDict_New();
-    PyObject* items = PyDict_Items(dct);
-    for (Py_ssize_t i = 0; i < PyList_GET_SIZE(items); ++i) {
-        PyObject* value = PyTuple_GET_ITEM(PyList_GET_ITEM(items, i), 1);
-        if (PyCallable_Check(value))
-            PyDict_SetItem(clbs, PyTuple_GET_ITEM(PyList_GET_ITEM(items, i), 0), value);
-    }
-    Py_DECREF(items);
-    if (PyDict_DelItem(clbs, PyStrings::gInit) != 0)
-        PyErr_Clear();
-
 // protected methods and data need their access changed in the C++ trampoline and then
 // exposed on the Python side; so, collect their names as we go along
     std::set<std::string> protected_names;
 
+// the methods overridden, which (with the bases) determine the dispatcher
+    std::set<std::string> overridden;
+    if (PyMapping_HasKeyString(dct, (char*)"__destruct__"))
+        overridden.insert("__destruct__");
+
 // simple case: methods from current class (collect constructors along the way)
     int has_default = 0, has_cctor = 0, has_ctors = 0, has_tmpl_ctors = 0;
     AllCtors_t ctors{base_infos.size()};
@@ -304,6 +390,7 @@ bool CPyCppyy::InsertDispatcher(CPPScope* klass, PyObject* bases, PyObject* dct,
             }
 
             InjectMethod(method, mtCppName, code);
+            overridden.insert(mtCppName);
 
             if (PyDict_DelItem(clbs, key) != 0)
                 PyErr_Clear();        // happens for overloads
@@ -345,6 +432,7 @@ bool CPyCppyy::InsertDispatcher(CPPScope* klass, PyObject* bases, PyObject* dct,
                     for (auto method : methods)
                         InjectMethod(method, mtCppName, code);
                     if (!methods.empty()) {
+                        overridden.insert(mtCppName);
                         if (PyDict_DelItem(clbs, key) != 0) PyErr_Clear();
                     }
                 }
@@ -354,6 +442,14 @@ bool CPyCppyy::InsertDispatcher(CPPScope* klass, PyObject* bases, PyObject* dct,
     }
     Py_DECREF(clbs);
 
+// a different set of python callables may still override the same methods
+    const std::string& ovr_key = DispatcherKey(klass->fCppType, base_infos, overridden, 'o');
+    cached = gDispatchers.find(ovr_key);
+    if (cached != gDispatchers.end()) {
+        gDispatchers[clbs_key] = cached->second;
+        return SetupDispatcher(klass, cached->second.fScope, cached->second.fProtectedNames, err);
+    }
+
 // constructors: build up from the argument types of the base class, for use by the Python
 // derived class (inheriting with/ "using" does not work b/c base class constructors may
 // have been deleted),
@@ -444,6 +540,22 @@ bool CPyCppyy::InsertDispatcher(CPPScope* klass, PyObject* bases, PyObject* dct,
         err << "failed to retrieve the internal dispatcher";
         return false;
     }
+
+    DispatcherInfo_t& info = gDispatchers[ovr_key];
+    info.fScope = disp;
+    info.fProtectedNames = protected_names;
+    gDispatchers[clbs_key] = info;
+
+    return SetupDispatcher(klass, disp, protected_names, err);
+}
+
+//----------------------------------------------------------------------------
+static bool SetupDispatcher(CPyCppyy::CPPScope* klass, Cppyy::TCppScope_t disp,
+    const std::set<std::string>& protected_names, std::ostringstream& err)
+{
+// Interject the (new or re-used) dispatcher for klass.
+    using namespace CPyCppyy;
+
     klass->fCppType = disp;
 
 // at this point, the dispatcher only lives in C++, as opposed to regular classes
@@ -451,6 +563,10 @@ bool CPyCppyy::InsertDispatcher(CPPScope* klass, PyObject* bases, PyObject* dct,
 // later use by e.g. the MemoryRegulator
     unsigned int flags = (unsigned int)(klass->fFlags & CPPScope::kIsMultiCross);
     PyObject* disp_proxy = CPyCppyy::CreateScopeProxy(disp, 0, flags);
+    if (!disp_proxy) {
+        err << "failed to create the dispatcher proxy";
+        return false;
+    }
     if (flags) ((CPPScope*)disp_proxy)->fFlags |= CPPScope::kIsMultiCross;
     ((CPPScope*)disp_proxy)->fFlags |= CPPScope::kIsPython;
 
@@ -458,6 +574,7 @@ bool CPyCppyy::InsertDispatcher(CPPScope* klass, PyObject* bases, PyObject* dct,
 // to the Python dictionary (the C++ dispatcher's Python proxy is not a base of the
 // Python class to keep the inheritance tree intact)
     for (const auto& name : protected_names) {
+         BuildLazyMember(disp_proxy, name, false);
          PyObject* disp_dct = PyObject_GetAttr(disp_proxy, PyStrings::gDict);
          PyObject* pyf = PyMapping_GetItemString(disp_dct, (char*)name.c_str());
          if (pyf) {
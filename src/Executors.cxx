@@ -5,12 +5,14 @@
 #include "LowLevelViews.h"
 #include "ProxyWrappers.h"
 #include "PyStrings.h"
+#include "Threading.h"
 #include "TypeManip.h"
 #include "Utility.h"
 
 // Standard
 #include <cstring>
 #include <map>
+#include <unordered_map>
 #include <new>
 #include <sstream>
 #include <utility>
@@ -20,9 +22,23 @@
 
 //- data _____________________________________________________________________
 namespace CPyCppyy {
-    typedef std::map<std::string, ef_t> ExecFactories_t;
+    typedef std::unordered_map<std::string, ef_t> ExecFactories_t;
     static ExecFactories_t gExecFactories;
 
+// memoized resolutions of types and type names to factories (only where the factory
+// is used as-is); cleared whenever factories are (un)registered
+    typedef std::unordered_map<Cppyy::TCppType_t, ef_t> ExecFactoryMemo_t;
+    static ExecFactoryMemo_t gExecFactoryMemo;
+    static ExecFactories_t gExecFactoryNameMemo;
+
+// pool of shared executors for method returns, by type (see gConvPool)
+    typedef std::unordered_map<Cppyy::TCppType_t, Executor*> ExecPool_t;
+    static ExecPool_t gExecPool;
+    struct ExecPoolRef_t { Cppyy::TCppType_t fType; size_t fRefCount; };
+    static std::unordered_map<Executor*, ExecPoolRef_t> gExecPoolRefs;
+    static size_t   gExecPoolReferences = 0;
+    static uint64_t gExecPoolHits = 0;
+
     extern PyObject* gNullPtrObject;
 
     extern std::set<std::string> gIteratorTypes;
@@ -104,6 +120,15 @@ static inline Cppyy::TCppObject_t GILCallConstructor(
 #endif
 }
 
+static inline unsigned BindFlags(CPyCppyy::CallContext* ctxt, unsigned flags = 0)
+{
+// objects returned from methods flagged as such are not tracked for identity; this
+// is applied to the result only, not to objects bound during the call (callbacks)
+    if (ctxt->fFlags & CPyCppyy::CallContext::kNoMemReg)
+        flags |= CPyCppyy::CPPInstance::kNoMemReg;
+    return flags;
+}
+
 static inline PyObject* CPyCppyy_PyText_FromLong(long cl)
 {
 // python chars are range(256)
@@ -601,16 +626,67 @@ PyObject* CPyCppyy::InstancePtrExecutor::Execute(
     Cppyy::TCppMethod_t method, Cppyy::TCppObject_t self, CallContext* ctxt)
 {
 // execute <method> with argument <self, ctxt>, construct python proxy object return value
-    return BindCppObject((void*)GILCallR(method, self, ctxt), fClass);
+    return BindCppObject((void*)GILCallR(method, self, ctxt), fPyClass, BindFlags(ctxt));
 }
 
 //----------------------------------------------------------------------------
 CPyCppyy::InstanceExecutor::InstanceExecutor(Cppyy::TCppScope_t klass) :
-    fClass(klass), fFlags(CPPInstance::kIsValue | CPPInstance::kIsOwner)
+    fClass(klass), fPyClass(klass), fFlags(CPPInstance::kIsValue | CPPInstance::kIsOwner),
+    fInlineSize(-1)
 {
     /* empty */
 }
 
+//----------------------------------------------------------------------------
+static int InlineSize(Cppyy::TCppScope_t klass)
+{
+// Determine whether objects of klass returned by value can be held inline in their
+// proxy (see BindCppValueInline), i.e. are small, trivially copyable, and not of a
+// special class; returns their size if so, 0 otherwise.
+#ifndef CPYCPPYY_INLINE_VALUES
+    (void)klass;
+    return 0;
+#else
+    using namespace CPyCppyy;
+
+    size_t sz = Cppyy::SizeOf(klass);
+    if (!sz || CPYCPPYY_INLINE_MAXSIZE < sz)
+        return 0;
+
+    PyObject* pyclass = CreateScopeProxy(klass);
+    if (!pyclass) {
+        PyErr_Clear();
+        return 0;
+    }
+    bool isSpecial = ((CPPClass*)pyclass)->fFlags & (CPPScope::kIsSmart | CPPScope::kIsException);
+    Py_DECREF(pyclass);
+    if (isSpecial)
+        return 0;
+
+// the type traits are only available in C++, so JIT a check
+    static int sCount = 0;
+    const std::string& fname = "inline_check" + std::to_string(sCount++);
+    std::ostringstream code;
+    code << "#include <type_traits>\n"
+            "namespace __cppyy_internal {\n"
+            "bool " << fname << "() {\n"
+            "  typedef " << Cppyy::GetScopedFinalName(klass) << " T;\n"
+            "  return std::is_trivially_copyable<T>::value && alignof(T) <= 16;\n"
+            "} }";
+
+    if (!Cppyy::Compile(code.str(), true /* silent */))
+        return 0;
+
+    const auto& methods = Cppyy::GetMethodsFromName(Cppyy::GetScope("__cppyy_internal"), fname);
+    if (methods.empty())
+        return 0;
+
+    typedef bool (*inlinecheck_t)();
+    inlinecheck_t check = (inlinecheck_t)Cppyy::GetFunctionAddress(methods[0], false);
+    return (check && check()) ? (int)sz : 0;
+#endif
+}
+
 //----------------------------------------------------------------------------
 PyObject* CPyCppyy::InstanceExecutor::Execute(
     Cppyy::TCppMethod_t method, Cppyy::TCppObject_t self, CallContext* ctxt)
@@ -624,8 +700,19 @@ PyObject* CPyCppyy::InstanceExecutor::Execute(
         return nullptr;
     }
 
+// small, trivially copyable results are relocated into their proxy, leaving no C++
+// heap allocation behind
+    if (fInlineSize < 0)
+        fInlineSize = InlineSize(fClass);
+
+    if (fInlineSize) {
+        PyObject* pyobj = BindCppValueInline(value, fPyClass, (size_t)fInlineSize, BindFlags(ctxt, fFlags));
+        Cppyy::Deallocate(fClass, value);
+        return pyobj;
+    }
+
 // the result can then be bound
-    PyObject* pyobj = BindCppObjectNoCast(value, fClass, fFlags);
+    PyObject* pyobj = BindCppObjectNoCast(value, fPyClass, BindFlags(ctxt, fFlags));
     if (!pyobj)
         return nullptr;
 
@@ -648,7 +735,7 @@ PyObject* CPyCppyy::InstanceRefExecutor::Execute(
     Cppyy::TCppMethod_t method, Cppyy::TCppObject_t self, CallContext* ctxt)
 {
 // executor binds the result to the left-hand side, overwriting if an old object
-    PyObject* result = BindCppObject((void*)GILCallR(method, self, ctxt), fClass);
+    PyObject* result = BindCppObject((void*)GILCallR(method, self, ctxt), fPyClass, BindFlags(ctxt));
     if (!result || !fAssignable)
         return result;
     else {
@@ -706,7 +793,7 @@ PyObject* CPyCppyy::InstancePtrPtrExecutor::Execute(
 
     void** result = (void**)GILCallR(method, self, ctxt);
     if (!fAssignable)
-        return BindCppObject((void*)result, fClass,
+        return BindCppObject((void*)result, fPyClass,
                              CPPInstance::kIsPtrPtr | CPPInstance::kIsReference);
 
     CPPInstance* cppinst = (CPPInstance*)fAssignable;
@@ -729,7 +816,7 @@ PyObject* CPyCppyy::InstancePtrRefExecutor::Execute(
 
     void** result = (void**)GILCallR(method, self, ctxt);
     if (!fAssignable)
-        return BindCppObject(*result, fClass);
+        return BindCppObject(*result, fPyClass, BindFlags(ctxt));
 
     CPPInstance* cppinst = (CPPInstance*)fAssignable;
     *result = cppinst->GetObject();;
@@ -793,6 +880,7 @@ CPyCppyy::Executor* CPyCppyy::CreateExecutor(const std::string& fullType, cdims_
 //   4) additional special case for enums
 //
 // If all fails, void is used, which will cause the return type to be ignored on use
+    BindingsLockGuard_t lock(gBindingsLock);
 
   // FIXME:
   //assert(!fullType.empty() && "This routine assumes non-empty fullType");
@@ -804,6 +892,11 @@ CPyCppyy::Executor* CPyCppyy::CreateExecutor(const std::string& fullType, cdims_
     if (h != gExecFactories.end())
         return (h->second)(dims);
 
+// next best is a name that was resolved before
+    h = gExecFactoryNameMemo.find(fullType);
+    if (h != gExecFactoryNameMemo.end())
+        return (h->second)(dims);
+
 // resolve typedefs etc.
     const std::string resolvedType = Cppyy::ResolveName(fullType);
 
@@ -811,7 +904,7 @@ CPyCppyy::Executor* CPyCppyy::CreateExecutor(const std::string& fullType, cdims_
     if (resolvedType != fullType) {
          h = gExecFactories.find(resolvedType);
          if (h != gExecFactories.end())
-              return (h->second)(dims);
+              return (gExecFactoryNameMemo[fullType] = h->second)(dims);
     }
 
 //-- nothing? ok, collect information about the type and possible qualifiers/decorators
@@ -822,7 +915,7 @@ CPyCppyy::Executor* CPyCppyy::CreateExecutor(const std::string& fullType, cdims_
 // accept unqualified type (as python does not know about qualifiers)
     h = gExecFactories.find(realType + cpd);
     if (h != gExecFactories.end())
-        return (h->second)(dims);
+        return (gExecFactoryNameMemo[fullType] = h->second)(dims);
 
 // drop const, as that is mostly meaningless to python (with the exception
 // of c-strings, but those are specialized in the converter map)
@@ -830,7 +923,7 @@ CPyCppyy::Executor* CPyCppyy::CreateExecutor(const std::string& fullType, cdims_
         realType = TypeManip::remove_const(realType);
         h = gExecFactories.find(realType + cpd);
         if (h != gExecFactories.end())
-            return (h->second)(dims);
+            return (gExecFactoryNameMemo[fullType] = h->second)(dims);
     }
 
 // simple array types
@@ -844,7 +937,7 @@ CPyCppyy::Executor* CPyCppyy::CreateExecutor(const std::string& fullType, cdims_
     if (cpd == "[]") {
         h = gExecFactories.find(realType + "*");
         if (h != gExecFactories.end())
-            return (h->second)(dims);
+            return (gExecFactoryNameMemo[fullType] = h->second)(dims);
     }
 
 // C++ classes and special cases
@@ -901,12 +994,18 @@ CPyCppyy::Executor* CPyCppyy::CreateExecutor(Cppyy::TCppType_t type, cdims_t dim
 //   4) additional special case for enums
 //
 // If all fails, void is used, which will cause the return type to be ignored on use
+    BindingsLockGuard_t lock(gBindingsLock);
+
+// a type that was resolved before takes a single lookup
+    auto m = gExecFactoryMemo.find(type);
+    if (m != gExecFactoryMemo.end())
+        return (m->second)(dims);
 
 // an exactly matching executor is best
     std::string fullType = Cppyy::GetTypeAsString(type);
     ExecFactories_t::iterator h = gExecFactories.find(fullType);
     if (h != gExecFactories.end())
-        return (h->second)(dims);
+        return (gExecFactoryMemo[type] = h->second)(dims);
 
 // resolve typedefs etc.
     Cppyy::TCppType_t resolvedType = Cppyy::ResolveType(type);
@@ -916,7 +1015,7 @@ CPyCppyy::Executor* CPyCppyy::CreateExecutor(Cppyy::TCppType_t type, cdims_t dim
     if (resolvedTypeStr != fullType) {
          h = gExecFactories.find(resolvedTypeStr);
          if (h != gExecFactories.end())
-              return (h->second)(dims);
+              return (gExecFactoryMemo[type] = h->second)(dims);
     }
 
 //-- nothing? ok, collect information about the type and possible qualifiers/decorators
@@ -929,7 +1028,7 @@ CPyCppyy::Executor* CPyCppyy::CreateExecutor(Cppyy::TCppType_t type, cdims_t dim
 // accept unqualified type (as python does not know about qualifiers)
     h = gExecFactories.find(compounded);
     if (h != gExecFactories.end())
-        return (h->second)(dims);
+        return (gExecFactoryMemo[type] = h->second)(dims);
 
 // drop const, as that is mostly meaningless to python (with the exception
 // of c-strings, but those are specialized in the converter map)
@@ -937,7 +1036,7 @@ CPyCppyy::Executor* CPyCppyy::CreateExecutor(Cppyy::TCppType_t type, cdims_t dim
         realTypeStr = TypeManip::remove_const(realTypeStr);
         h = gExecFactories.find(compounded);
         if (h != gExecFactories.end())
-            return (h->second)(dims);
+            return (gExecFactoryMemo[type] = h->second)(dims);
     }
 
 // simple array types
@@ -951,7 +1050,7 @@ CPyCppyy::Executor* CPyCppyy::CreateExecutor(Cppyy::TCppType_t type, cdims_t dim
     if (cpd == "[]") {
         h = gExecFactories.find(realTypeStr + "*");
         if (h != gExecFactories.end())
-            return (h->second)(dims);
+            return (gExecFactoryMemo[type] = h->second)(dims);
     }
 
 // C++ classes and special cases
@@ -999,16 +1098,76 @@ void CPyCppyy::DestroyExecutor(Executor* p)
         delete p;  // state-less executors are always shared
 }
 
+//----------------------------------------------------------------------------
+CPYCPPYY_EXPORT
+CPyCppyy::Executor* CPyCppyy::AcquireExecutor(Cppyy::TCppType_t type)
+{
+// return the shared executor for type if available, otherwise create a new one,
+// which is shared from here on if it is shareable
+    BindingsLockGuard_t lock(gBindingsLock);
+    auto p = gExecPool.find(type);
+    if (p != gExecPool.end()) {
+        gExecPoolRefs[p->second].fRefCount += 1;
+        gExecPoolReferences += 1;
+        gExecPoolHits += 1;
+        return p->second;
+    }
+
+    Executor* exec = CreateExecutor(type);
+    if (exec && exec->HasState() && exec->IsShareable()) {
+        gExecPool[type] = exec;
+        gExecPoolRefs[exec] = ExecPoolRef_t{type, 1};
+        gExecPoolReferences += 1;
+    }
+
+    return exec;
+}
+
+//----------------------------------------------------------------------------
+CPYCPPYY_EXPORT
+void CPyCppyy::ReleaseExecutor(Executor* p)
+{
+// release an executor from AcquireExecutor(); executors not in the pool are
+// destroyed as usual
+    BindingsLockGuard_t lock(gBindingsLock);
+    auto r = p ? gExecPoolRefs.find(p) : gExecPoolRefs.end();
+    if (r == gExecPoolRefs.end()) {
+        DestroyExecutor(p);
+        return;
+    }
+
+    gExecPoolReferences -= 1;
+    if (--r->second.fRefCount == 0) {
+        auto e = gExecPool.find(r->second.fType);
+        if (e != gExecPool.end() && e->second == p)
+            gExecPool.erase(e);
+        gExecPoolRefs.erase(r);
+        delete p;
+    }
+}
+
+//----------------------------------------------------------------------------
+CPYCPPYY_EXPORT
+CPyCppyy::ExecutorPoolStats_t CPyCppyy::GetExecutorPoolStats()
+{
+    BindingsLockGuard_t lock(gBindingsLock);
+    return ExecutorPoolStats_t{gExecPoolRefs.size(), gExecPoolReferences, gExecPoolHits};
+}
+
 //----------------------------------------------------------------------------
 CPYCPPYY_EXPORT
 bool CPyCppyy::RegisterExecutor(const std::string& name, ef_t fac)
 {
 // register a custom executor
+    BindingsLockGuard_t lock(gBindingsLock);
     auto f = gExecFactories.find(name);
     if (f != gExecFactories.end())
         return false;
 
     gExecFactories[name] = fac;
+    gExecFactoryMemo.clear();
+    gExecFactoryNameMemo.clear();
+    gExecPool.clear();        // shared executors in use stay alive until released
     return true;
 }
 
@@ -1017,9 +1176,13 @@ CPYCPPYY_EXPORT
 bool CPyCppyy::UnregisterExecutor(const std::string& name)
 {
 // remove a custom executor
+    BindingsLockGuard_t lock(gBindingsLock);
     auto f = gExecFactories.find(name);
     if (f != gExecFactories.end()) {
         gExecFactories.erase(f);
+        gExecFactoryMemo.clear();
+        gExecFactoryNameMemo.clear();
+        gExecPool.clear();
         return true;
     }
     return false;
@@ -18,6 +18,10 @@ public:
     virtual PyObject* Execute(
         Cppyy::TCppMethod_t, Cppyy::TCppObject_t, CallContext*) = 0;
     virtual bool HasState() { return false; }
+
+// executors whose state is fully set on construction can be shared between all
+// methods with the same return type
+    virtual bool IsShareable() { return !HasState(); }
 };
 
 // special case needed for CPPSetItem
@@ -39,6 +43,17 @@ typedef Executor* (*ef_t) (cdims_t);
 CPYCPPYY_EXPORT bool RegisterExecutor(const std::string& name, ef_t fac);
 CPYCPPYY_EXPORT bool UnregisterExecutor(const std::string& name);
 
+// shared executors for method returns (see AcquireConverter())
+CPYCPPYY_EXPORT Executor* AcquireExecutor(Cppyy::TCppType_t type);
+CPYCPPYY_EXPORT void ReleaseExecutor(Executor* p);
+
+struct ExecutorPoolStats_t {
+    size_t   fInstances;     // shared executors currently alive
+    size_t   fReferences;    // uses of shared executors, i.e. executors otherwise alive
+    uint64_t fHits;          // acquisitions served from the pool
+};
+CPYCPPYY_EXPORT ExecutorPoolStats_t GetExecutorPoolStats();
+
 // helper for the actual call
 CPYCPPYY_EXPORT void* CallVoidP(Cppyy::TCppMethod_t, Cppyy::TCppObject_t, CallContext*);
 
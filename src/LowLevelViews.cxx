@@ -35,6 +35,18 @@ static inline void set_strides(Py_buffer& view, size_t itemsize, bool isfix) {
 }
 
 
+static inline bool ll_is_valid(CPyCppyy::LowLevelView* self)
+{
+// views on memory owned by e.g. an STL container are invalidated when it reallocates
+    if (self->fIsValid && !self->fIsValid(self)) {
+        PyErr_SetString(PyExc_ReferenceError,
+            "viewed memory was moved or released by its owner; the view is stale");
+        return false;
+    }
+    return true;
+}
+
+
 //= CPyCppyy low level view construction/destruction =========================
 static CPyCppyy::LowLevelView* ll_new(PyTypeObject* subtype, PyObject*, PyObject*)
 {
@@ -48,6 +60,9 @@ static CPyCppyy::LowLevelView* ll_new(PyTypeObject* subtype, PyObject*, PyObject
     pyobj->fBuf = nullptr;
     pyobj->fConverter = nullptr;
     pyobj->fElemCnv   = nullptr;
+    pyobj->fController = nullptr;
+    pyobj->fIsValid    = nullptr;
+    pyobj->fIsValidArg = nullptr;
 
     return pyobj;
 }
@@ -72,6 +87,8 @@ static void ll_dealloc(CPyCppyy::LowLevelView* pyobj)
     if (pyobj->fConverter && pyobj->fConverter->HasState())
         delete pyobj->fConverter;
 
+    Py_XDECREF(pyobj->fController);
+
     Py_TYPE(pyobj)->tp_free((PyObject*)pyobj);
 }
 
@@ -401,6 +418,9 @@ static PyObject* ll_item(CPyCppyy::LowLevelView* self, Py_ssize_t index)
         return nullptr;
     }
 
+    if (!ll_is_valid(self))
+        return nullptr;
+
     void* ptr = ptr_from_index(self, index);
     if (ptr) {
         bool isfix = (intptr_t)view.internal & CPyCppyy::LowLevelView::kIsFixed;
@@ -426,6 +446,9 @@ static PyObject* ll_item_multi(CPyCppyy::LowLevelView* self, PyObject *tup)
         return nullptr;
     }
 
+    if (!ll_is_valid(self))
+        return nullptr;
+
     void* ptr = ptr_from_tuple(self, tup);
 
 // if there's an error, it was already set by lookup_dimension
@@ -446,6 +469,8 @@ static PyObject* ll_subscript(CPyCppyy::LowLevelView* self, PyObject* key)
 
     if (view.ndim == 0) {
         if (PyTuple_Check(key) && PyTuple_GET_SIZE(key) == 0) {
+            if (!ll_is_valid(self))
+                return nullptr;
             return self->fConverter->FromMemory(self->get_buf());
         }
         else if (key == Py_Ellipsis) {
@@ -501,6 +526,9 @@ static int ll_ass_sub(CPyCppyy::LowLevelView* self, PyObject* key, PyObject* val
         return -1;
     }
 
+    if (!ll_is_valid(self))
+        return -1;
+
     if (view.ndim == 0) {
         if (key == Py_Ellipsis ||
             (PyTuple_Check(key) && PyTuple_GET_SIZE(key) == 0)) {
@@ -607,6 +635,8 @@ static Py_ssize_t ll_getsegcount(PyObject*, Py_ssize_t* lenp)
 static int ll_getbuf(CPyCppyy::LowLevelView* self, Py_buffer* view, int flags)
 {
 // Simplified from memoryobject, as we're always dealing with C arrays.
+    if (!ll_is_valid(self))
+        return -1;
 
 // start with full copy
     *view = self->fBufInfo;
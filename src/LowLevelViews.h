@@ -30,6 +30,9 @@ public:
     void**      fBuf;
     Converter*  fConverter;
     Converter*  fElemCnv;
+    PyObject*   fController;              // owner of the memory (kept alive), if any
+    bool      (*fIsValid)(LowLevelView*); // false if the owner moved or released the memory
+    void*       fIsValidArg;              // for use by fIsValid (e.g. a cached checker)
 
 public:
     void* get_buf() { return fBuf ? *fBuf : fBufInfo.buf; }
@@ -3,6 +3,7 @@
 #include "MemoryRegulator.h"
 #include "CPPInstance.h"
 #include "ProxyWrappers.h"
+#include "Threading.h"
 
 // Standard
 #include <assert.h>
@@ -115,16 +116,16 @@ bool CPyCppyy::MemoryRegulator::RecursiveRemove(
         return false;
     }
 
-// see whether we're tracking this object
-    CppToPyMap_t::iterator ppo = cppobjs->find(cppobj);
-
-    if (ppo != cppobjs->end()) {
-    // get the tracked object
-        CPPInstance* pyobj = (CPPInstance*)ppo->second;
+// see whether we're tracking this object, and if so, stop tracking it
+    CPPInstance* pyobj = nullptr;
+    {
+        LockGuard_t lock(cppobjs->fMutex);
+        pyobj = (CPPInstance*)cppobjs->Erase(cppobj);
+        if (pyobj)
+            pyobj->fFlags &= ~CPPInstance::kIsRegulated;
+    }
 
-    // erase the object from tracking
-        pyobj->fFlags &= ~CPPInstance::kIsRegulated;
-        cppobjs->erase(ppo);
+    if (pyobj) {
 
     // nullify the object
         if (!CPyCppyy_NoneType.tp_traverse) {
@@ -152,6 +153,7 @@ bool CPyCppyy::MemoryRegulator::RecursiveRemove(
         ((PyObject*)pyobj)->ob_refcnt = refcnt;
 
     // cleanup object internals
+        pyobj->fFlags &= ~CPPInstance::kIsInline;    // no relocation needed
         pyobj->CppOwns();              // held object is out of scope now anyway
         op_dealloc_nofree(pyobj);      // normal object cleanup, while keeping memory
 
@@ -188,11 +190,10 @@ bool CPyCppyy::MemoryRegulator::RegisterPyObject(
 
 // if an address was already associated with a different object, then stop following
 // the old and force insert the new proxy for following
-    const auto& res = cppobjs->insert(std::make_pair(cppobj, (PyObject*)pyobj));
-    if (!res.second) {
-        ((CPPInstance*)res.first->second)->fFlags &= ~CPPInstance::kIsRegulated;
-        (*cppobjs)[cppobj] = (PyObject*)pyobj;
-    }
+    LockGuard_t lock(cppobjs->fMutex);
+    PyObject* old = cppobjs->Insert(cppobj, (PyObject*)pyobj);
+    if (old)
+        ((CPPInstance*)old)->fFlags &= ~CPPInstance::kIsRegulated;
 
     pyobj->fFlags |= CPPInstance::kIsRegulated;
     return true;
@@ -219,7 +220,8 @@ bool CPyCppyy::MemoryRegulator::UnregisterPyObject(CPPInstance* pyobj, PyObject*
         return false;
 
 // erase if tracked
-    if (cppobjs->erase(cppobj)) {
+    LockGuard_t lock(cppobjs->fMutex);
+    if (cppobjs->Erase(cppobj)) {
         pyobj->fFlags &= ~CPPInstance::kIsRegulated;
         return true;
     }
@@ -238,13 +240,10 @@ PyObject* CPyCppyy::MemoryRegulator::RetrievePyObject(Cppyy::TCppObject_t cppobj
     if (!cppobjs)
         return nullptr;
 
-    CppToPyMap_t::iterator ppo = cppobjs->find(cppobj);
-    if (ppo != cppobjs->end()) {
-        Py_INCREF(ppo->second);
-        return ppo->second;
-    }
-
-    return nullptr;
+    LockGuard_t lock(cppobjs->fMutex);
+    PyObject* pyobj = cppobjs->Find(cppobj);
+    Py_XINCREF(pyobj);
+    return pyobj;
 }
 
 
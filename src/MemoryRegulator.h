@@ -33,6 +33,16 @@ public:
 // set hooks for custom memory regulation
     static void SetRegisterHook(MemHook_t h);
     static void SetUnregisterHook(MemHook_t h);
+
+// identity tracking can be switched off for the current thread, e.g. for bulk extraction
+// of objects from containers: proxies bound while bypassed are not looked up, nor tracked
+// (as if bound with CPPInstance::kNoMemReg), so the same C++ object may get several proxies
+    static bool IsBypassed() { return 0 < sBypassDepth; }
+    static void BeginBypass() { sBypassDepth += 1; }
+    static void EndBypass() { if (0 < sBypassDepth) sBypassDepth -= 1; }
+
+private:
+    inline static thread_local int sBypassDepth = 0;
 };
 
 } // namespace CPyCppyy
@@ -15,7 +15,9 @@
 #include "MemoryRegulator.h"
 #include "PyStrings.h"
 #include "Pythonize.h"
+#include "ReflectionCache.h"
 #include "TemplateProxy.h"
+#include "Threading.h"
 #include "TupleOfInstances.h"
 #include "TypeManip.h"
 #include "Utility.h"
@@ -26,6 +28,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <string.h>
 #include <vector>
 
 
@@ -36,10 +39,165 @@ namespace CPyCppyy {
     extern std::set<Cppyy::TCppType_t> gPinnedTypes;
 }
 
-// to prevent having to walk scopes, track python classes by C++ class
-typedef std::map<Cppyy::TCppScope_t, PyObject*> PyClassMap_t;
+// to prevent having to walk scopes, track python classes by C++ class; this is an
+// open addressing hash table (linear probing, with deletion by backward shifting, so
+// without tombstones) holding borrowed references: each class has a weakref, which
+// removes the entry through its callback when the class goes away
+namespace {
+
+using namespace CPyCppyy;
+
+// bumped whenever an entry is replaced or removed, to invalidate PyClassRef's
+uint64_t gPyClassGeneration = 0;
+
+class PyClassMap_t {
+public:
+    PyClassMap_t() : fMask(0), fSize(0), fNull(nullptr), fLastScope(0), fLastClass(nullptr) {}
+
+    PyObject* Find(Cppyy::TCppScope_t scope) {
+    // returns a new reference; most lookups are for the same class in a row, e.g. in
+    // loops over return values
+        LockGuard_t lock(fMutex);
+        if (scope == fLastScope && fLastClass) {
+            Py_INCREF(fLastClass);
+            return fLastClass;
+        }
+
+        const Entry_t* entry = scope ? Lookup(scope) : fNull.fWeakRef ? &fNull : nullptr;
+        if (!entry)
+            return nullptr;
+
+        fLastScope = scope;
+        fLastClass = entry->fClass;
+        Py_INCREF(fLastClass);
+        return fLastClass;
+    }
+
+    void Insert(Cppyy::TCppScope_t scope, PyObject* pyclass, PyObject* wref) {
+        LockGuard_t lock(fMutex);
+        fLastClass = nullptr;
+        Entry_t* entry = scope ? Lookup(scope) : &fNull;
+        if (entry) {
+            Py_XDECREF(entry->fWeakRef);
+            entry->fClass = pyclass;
+            entry->fWeakRef = wref;
+            gPyClassGeneration += 1;
+            return;
+        }
+
+        if (fTable.empty() || fTable.size() <= 2*(fSize+1))
+            Grow();
+        size_t idx = Home(scope);
+        while (fTable[idx].fScope)
+            idx = (idx+1) & fMask;
+        fTable[idx] = Entry_t{scope, pyclass, wref};
+        fSize += 1;
+    }
+
+    void Erase(Cppyy::TCppScope_t scope, PyObject* wref) {
+    // only erase if the entry still belongs to the class that wref refers to
+        LockGuard_t lock(fMutex);
+        fLastClass = nullptr;
+        if (!scope) {
+            if (fNull.fWeakRef == wref) {
+                fNull = Entry_t{0, nullptr, nullptr};
+                gPyClassGeneration += 1;
+                Py_DECREF(wref);
+            }
+            return;
+        }
+
+        Entry_t* entry = Lookup(scope);
+        if (!entry || entry->fWeakRef != wref)
+            return;
+
+    // shift back entries that would otherwise become unreachable
+        size_t hole = entry - fTable.data();
+        size_t idx = hole;
+        while (true) {
+            idx = (idx+1) & fMask;
+            if (!fTable[idx].fScope)
+                break;
+            size_t home = Home(fTable[idx].fScope);
+            if (((idx - home) & fMask) >= ((idx - hole) & fMask)) {
+                fTable[hole] = fTable[idx];
+                hole = idx;
+            }
+        }
+        fTable[hole] = Entry_t{0, nullptr, nullptr};
+        fSize -= 1;
+        gPyClassGeneration += 1;
+        Py_DECREF(wref);
+    }
+
+private:
+    struct Entry_t {
+        Cppyy::TCppScope_t fScope;
+        PyObject*          fClass;    // borrowed, kept valid by fWeakRef's callback
+        PyObject*          fWeakRef;
+    };
+
+    size_t Home(Cppyy::TCppScope_t scope) const {
+    // mix the pointer bits, as the low ones are mostly alignment
+        uint64_t h = (uint64_t)(uintptr_t)scope;
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdull;
+        h ^= h >> 33;
+        return (size_t)h & fMask;
+    }
+
+    Entry_t* Lookup(Cppyy::TCppScope_t scope) {
+        if (fTable.empty())
+            return nullptr;
+        size_t idx = Home(scope);
+        while (fTable[idx].fScope) {
+            if (fTable[idx].fScope == scope)
+                return &fTable[idx];
+            idx = (idx+1) & fMask;
+        }
+        return nullptr;
+    }
+
+    void Grow() {
+        std::vector<Entry_t> old(fTable.empty() ? 64 : 2*fTable.size(), Entry_t{0, nullptr, nullptr});
+        old.swap(fTable);
+        fMask = fTable.size()-1;
+        for (const auto& entry : old) {
+            if (!entry.fScope) continue;
+            size_t idx = Home(entry.fScope);
+            while (fTable[idx].fScope)
+                idx = (idx+1) & fMask;
+            fTable[idx] = entry;
+        }
+    }
+
+private:
+    std::vector<Entry_t> fTable;
+    size_t               fMask;
+    size_t               fSize;
+    Entry_t              fNull;       // for the null scope, which marks empty slots
+    Cppyy::TCppScope_t   fLastScope;
+    PyObject*            fLastClass;
+    Mutex                fMutex;
+};
+
+} // unnamed namespace
+
 static PyClassMap_t gPyClasses;
 
+static PyObject* pyclass_erase(PyObject* pyscope, PyObject* wref)
+{
+// weakref callback: the python class went away, remove its registry entry
+    gPyClasses.Erase((Cppyy::TCppScope_t)PyLong_AsVoidPtr(pyscope), wref);
+    Py_RETURN_NONE;
+}
+
+static PyMethodDef gPyClassEraseDef = {(char*)"_pyclass_erase",
+    (PyCFunction)pyclass_erase, METH_O, nullptr};
+
+// build class dictionaries on first use of the individual members
+static bool gLazyClassBuild = false;
+
 
 //- helpers --------------------------------------------------------------------
 
@@ -152,6 +310,59 @@ static inline void sync_templates(
     Py_DECREF(pyname);
 }
 
+static void GetMethodInfo(Cppyy::TCppMethod_t method, ReflectionCache::MethodInfo_t& mi)
+{
+// Query the backend for what is needed of method to build a class proxy (the same
+// data as kept in the persistent reflection cache).
+    typedef ReflectionCache::MethodInfo_t MethodInfo_t;
+    mi.fFlags = 0;
+    mi.fNArgs = 0;
+    if (!Cppyy::IsPublicMethod(method))
+        return;
+
+    mi.fFlags |= MethodInfo_t::kIsPublic;
+    mi.fName = Cppyy::GetMethodName(method);
+    if (mi.fName.empty() || mi.fName[0] == '~')
+        return;
+
+    if (Cppyy::IsConstructor(method))
+        mi.fFlags |= MethodInfo_t::kIsConstructor;
+    else if (Cppyy::IsTemplatedMethod(method))
+        mi.fFlags |= MethodInfo_t::kIsTemplated;
+    if (Cppyy::IsStaticMethod(method))
+        mi.fFlags |= MethodInfo_t::kIsStatic;
+    mi.fNArgs = (uint32_t)Cppyy::GetMethodNumArgs(method);
+
+// only operator[]/() need their return type (to decide on __setitem__)
+    const std::string& mtName = Utility::MapOperatorName(mi.fName, mi.fNArgs);
+    if (mtName == "__call__" || mtName == "__getitem__")
+        mi.fReturnType = Cppyy::GetMethodReturnTypeAsString(method);
+}
+
+static inline bool IsPySpecialName(const std::string& name)
+{
+    return name.size() >= 5 && name.compare(0, 2, "__") == 0 && \
+        name.compare(name.size()-2, 2, "__") == 0;
+}
+
+static inline PyCallable* MakeMethod(
+    Cppyy::TCppScope_t scope, Cppyy::TCppMethod_t method, bool isStatic)
+{
+    if (isStatic) return new CPPClassMethod(scope, method);
+    return new CPPMethod(scope, method);
+}
+
+static int lazy_setattro(PyObject* pyobj, PyObject* pyname, PyObject* value)
+{
+// Data members of lazily built classes may not have their descriptors yet; these
+// have to be built first, or the value would end up in the instance dictionary
+// (python-side derived classes inherit this slot, but have all members built)
+    PyObject* pyclass = (PyObject*)Py_TYPE(pyobj);
+    if (((CPPScope*)pyclass)->fFlags & CPPScope::kHasLazyBase)
+        ResolveLazyMember(pyclass, pyname);
+    return PyObject_GenericSetAttr(pyobj, pyname, value);
+}
+
 static int BuildScopeProxyDict(Cppyy::TCppScope_t scope, PyObject* pyclass, const unsigned int flags)
 {
 // Collect methods and data for the given scope, and add them to the given python
@@ -163,6 +374,12 @@ static int BuildScopeProxyDict(Cppyy::TCppScope_t scope, PyObject* pyclass, cons
     bool hasConstructor = false;
     Cppyy::TCppMethod_t potGetItem = (Cppyy::TCppMethod_t)0;
 
+// in lazy mode, plain methods and data members of classes are only recorded and built
+// on first access; python special methods are needed up front, as type slots do not
+// go through the metaclass' getattr
+    bool isLazy = gLazyClassBuild && !isNamespace && isComplete;
+    LazyMembers_t* lazy = isLazy ? new LazyMembers_t : nullptr;
+
 
 // load all public methods and data members
     typedef std::vector<PyCallable*> Callables_t;
@@ -180,19 +397,39 @@ static int BuildScopeProxyDict(Cppyy::TCppScope_t scope, PyObject* pyclass, cons
     if (isComplete)
       methods = Cppyy::GetClassMethods(scope);
 
-    for (auto &method : methods) {
+// the reflection data of the methods, from the persistent cache if available
+    typedef ReflectionCache::MethodInfo_t MethodInfo_t;
+    std::vector<MethodInfo_t> minfos;
+    std::string cacheName;
+    bool fromCache = false;
+    if (!methods.empty() && ReflectionCache::IsActive()) {
+        cacheName = Cppyy::GetScopedFinalName(scope);
+        fromCache = ReflectionCache::Lookup(cacheName, methods.size(), minfos);
+    }
+
+    if (!fromCache) {
+        minfos.resize(methods.size());
+        for (size_t imeth = 0; imeth < methods.size(); ++imeth)
+            GetMethodInfo(methods[imeth], minfos[imeth]);
+        if (!cacheName.empty())
+            ReflectionCache::Store(cacheName, minfos);
+    }
+
+    for (size_t imeth = 0; imeth < methods.size(); ++imeth) {
+        Cppyy::TCppMethod_t method = methods[imeth];
+        const MethodInfo_t& mi = minfos[imeth];
 
     // do not expose non-public methods as the Cling wrappers as those won't compile
-        if (!Cppyy::IsPublicMethod(method))
+        if (!(mi.fFlags & MethodInfo_t::kIsPublic))
             continue;
 
     // process the method based on its name
-        std::string mtCppName = Cppyy::GetMethodName(method);
+        const std::string& mtCppName = mi.fName;
 
     // special case trackers
         bool setupSetItem = false;
-        bool isConstructor = Cppyy::IsConstructor(method);
-        bool isTemplate = isConstructor ? false : Cppyy::IsTemplatedMethod(method);
+        bool isConstructor = mi.fFlags & MethodInfo_t::kIsConstructor;
+        bool isTemplate = mi.fFlags & MethodInfo_t::kIsTemplated;
         bool isStubbedOperator = false;
 
     // filter empty names (happens for namespaces, is bug?)
@@ -204,21 +441,20 @@ static int BuildScopeProxyDict(Cppyy::TCppScope_t scope, PyObject* pyclass, cons
             continue;
 
     // translate operators
-        std::string mtName = Utility::MapOperatorName(
-            mtCppName, Cppyy::GetMethodNumArgs(method), &isStubbedOperator);
+        std::string mtName = Utility::MapOperatorName(mtCppName, mi.fNArgs, &isStubbedOperator);
         if (mtName.empty())
             continue;
 
     // operator[]/() returning a reference type will be used for __setitem__
         bool isCall = mtName == "__call__";
         if (isCall || mtName == "__getitem__") {
-            const std::string& qual_return = Cppyy::GetMethodReturnTypeAsString(method);
+            const std::string& qual_return = mi.fReturnType;
             const std::string& cpd = TypeManip::compound(qual_return);
             if (!cpd.empty() && cpd[cpd.size()-1] == '&' && \
                     qual_return.find("const", 0, 5) == std::string::npos) {
                 if (isCall && !potGetItem) potGetItem = method;
                 setupSetItem = true;     // will add methods as overloads
-            } else if (isCall && 1 < Cppyy::GetMethodNumArgs(method)) {
+            } else if (isCall && 1 < mi.fNArgs) {
             // not a non-const by-ref return, thus better __getitem__ candidate; the
             // requirement for multiple arguments is that there is otherwise no benefit
             // over the use of normal __getitem__ (this allows multi-indexing arguments,
@@ -236,9 +472,15 @@ static int BuildScopeProxyDict(Cppyy::TCppScope_t scope, PyObject* pyclass, cons
         // it on the class when called explicitly
         }
 
+    // defer plain methods (names shared with templates are sorted out below)
+        if (lazy && !isTemplate && !isConstructor && !isStubbedOperator && !IsPySpecialName(mtName)) {
+            lazy->fMethods[mtName].push_back(method);
+            continue;
+        }
+
     // construct the holder
         PyCallable* pycall = nullptr;
-        if (Cppyy::IsStaticMethod(method))  // class method
+        if (mi.fFlags & MethodInfo_t::kIsStatic)  // class method
             pycall = new CPPClassMethod(scope, method);
         else if (isNamespace)               // free function
             pycall = new CPPFunction(scope, method);
@@ -317,6 +559,26 @@ static int BuildScopeProxyDict(Cppyy::TCppScope_t scope, PyObject* pyclass, cons
         }
     }
 
+// deferred methods sharing a name with a template or otherwise collected overloads are
+// built now, as their proxies exist already
+    if (lazy) {
+        PyObject* dct = PyObject_GetAttr(pyclass, PyStrings::gDict);
+        for (auto ilm = lazy->fMethods.begin(); ilm != lazy->fMethods.end(); ) {
+            PyObject* pyname = CPyCppyy_PyText_FromString(const_cast<char*>(ilm->first.c_str()));
+            PyObject* attr = PyDict_GetItem(dct, pyname);     // borrowed
+            Py_DECREF(pyname);
+            CallableCache_t::iterator icc = cache.find(ilm->first);
+            if (TemplateProxy_Check(attr) || icc != cache.end()) {
+                Callables_t& md = icc != cache.end() ? icc->second : cache[ilm->first];
+                for (auto method : ilm->second)
+                    md.push_back(MakeMethod(scope, method, Cppyy::IsStaticMethod(method)));
+                ilm = lazy->fMethods.erase(ilm);
+            } else
+                ++ilm;
+        }
+        Py_DECREF(dct);
+    }
+
 // add a pseudo-default ctor, if none defined
     if (!hasConstructor) {
         PyCallable* defctor = nullptr;
@@ -402,10 +664,36 @@ static int BuildScopeProxyDict(Cppyy::TCppScope_t scope, PyObject* pyclass, cons
             }
         }
 
+    // deferred (non-static) data members
+        if (lazy && !Cppyy::IsStaticDatamember(datamember)) {
+            lazy->fDataMembers[Cppyy::GetFinalName(datamember)] = datamember;
+            continue;
+        }
+
     // properties (aka public (static) data members)
         AddPropertyToClass(pyclass, scope, datamember);
     }
 
+    if (lazy) {
+        ((CPPScope*)pyclass)->fFlags |= CPPScope::kIsLazy;
+        ((CPPScope*)pyclass)->fLazyMembers = lazy;
+    }
+
+// only classes with lazily built bases (or lazy themselves) need to resolve pending
+// members ahead of attribute lookups and assignments; all others keep the plain slots
+    bool hasLazyBase = (bool)lazy;
+    PyObject* mro = ((PyTypeObject*)pyclass)->tp_mro;
+    for (Py_ssize_t ibase = 1; !hasLazyBase && mro && ibase < PyTuple_GET_SIZE(mro); ++ibase) {
+        PyObject* base = PyTuple_GET_ITEM(mro, ibase);
+        hasLazyBase = base != (PyObject*)&CPPInstance_Type && CPPScope_Check(base) && \
+            (((CPPScope*)base)->fFlags & CPPScope::kHasLazyBase);
+    }
+
+    if (hasLazyBase) {
+        ((CPPScope*)pyclass)->fFlags |= CPPScope::kHasLazyBase;
+        ((PyTypeObject*)pyclass)->tp_setattro = (setattrofunc)lazy_setattro;
+    }
+
 // restore custom __getattr__
     Py_TYPE(pyclass)->tp_getattro = oldgetattro;
 
@@ -500,16 +788,36 @@ static PyObject* BuildCppClassBases(Cppyy::TCppScope_t klass)
 PyObject* CPyCppyy::GetScopeProxy(Cppyy::TCppScope_t scope)
 {
 // Retrieve scope proxy from the known ones.
-    PyClassMap_t::iterator pci = gPyClasses.find(scope);
-    if (pci != gPyClasses.end()) {
-        PyObject* pyclass = PyWeakref_GetObject(pci->second);
-        if (pyclass != Py_None) {
-            Py_INCREF(pyclass);
-            return pyclass;
-        }
-    }
+    return gPyClasses.Find(scope);
+}
 
-    return nullptr;
+//----------------------------------------------------------------------------
+CPyCppyy::PyClassRef::~PyClassRef()
+{
+    if (fIsOwner && fPyClass && Py_IsInitialized())
+        Py_DECREF(fPyClass);
+}
+
+//----------------------------------------------------------------------------
+PyObject* CPyCppyy::PyClassRef::Get()
+{
+// Retrieve the python class, resolving it on first use or after the registry changed
+// (not to be used concurrently w/o the GIL, as the cached class may be replaced).
+    if (fPyClass && fGeneration == gPyClassGeneration)
+        return fPyClass;
+
+    if (fIsOwner)
+        Py_XDECREF(fPyClass);
+    fPyClass = CreateScopeProxy(fScope);
+    fGeneration = gPyClassGeneration;
+
+// classes are normally held by their enclosing scope, so the reference can be dropped,
+// with the registry entry guarding its validity; a class that is referenced from here
+// only is kept alive, as it would otherwise be gone before it could be used
+    fIsOwner = fPyClass && Py_REFCNT(fPyClass) == 1;
+    if (fPyClass && !fIsOwner)
+        Py_DECREF(fPyClass);
+    return fPyClass;
 }
 
 //----------------------------------------------------------------------------
@@ -672,7 +980,15 @@ PyObject* CPyCppyy::CreateScopeProxy(Cppyy::TCppScope_t scope, PyObject* parent,
 
     // store a ref from cppyy scope id to new python class
         if (pyscope && !(((CPPScope*)pyscope)->fFlags & CPPScope::kIsInComplete)) {
-            gPyClasses[scope] = PyWeakref_NewRef(pyscope, nullptr);
+            PyObject* pykey = PyLong_FromVoidPtr((void*)scope);
+            PyObject* callback = PyCFunction_New(&gPyClassEraseDef, pykey);
+            PyObject* wref = PyWeakref_NewRef(pyscope, callback);
+            Py_DECREF(callback);
+            Py_DECREF(pykey);
+            if (wref)
+                gPyClasses.Insert(scope, pyscope, wref);
+            else
+                PyErr_Clear();    // not cached, will be looked up again
 
             if (!(((CPPScope*)pyscope)->fFlags & CPPScope::kIsNamespace)) {
             // add python-style features to classes only
@@ -707,6 +1023,123 @@ PyObject* CPyCppyy::CreateScopeProxy(Cppyy::TCppScope_t scope, PyObject* parent,
 }
 
 
+//----------------------------------------------------------------------------
+bool CPyCppyy::BuildLazyMember(PyObject* pyclass, const std::string& name, bool inherited)
+{
+// Add the named member to the dictionary of the lazily built class that declares it:
+// pyclass or, if inherited, the first of its bases (in MRO order) to have it pending.
+    PyObject* mro = ((PyTypeObject*)pyclass)->tp_mro;
+    Py_ssize_t nbases = (inherited && mro) ? PyTuple_GET_SIZE(mro) : 1;
+    for (Py_ssize_t ibase = 0; ibase < nbases; ++ibase) {
+        PyObject* base = (inherited && mro) ? PyTuple_GET_ITEM(mro, ibase) : pyclass;
+        if (base == (PyObject*)&CPPInstance_Type || !CPPScope_Check(base))
+            continue;
+
+        CPPScope* klass = (CPPScope*)base;
+        LazyMembers_t* lazy = klass->fLazyMembers;
+        if (!(klass->fFlags & CPPScope::kIsLazy) || !lazy)
+            continue;
+
+        auto ilm = lazy->fMethods.find(name);
+        if (ilm != lazy->fMethods.end()) {
+            std::vector<PyCallable*> overloads;
+            overloads.reserve(ilm->second.size());
+            for (auto method : ilm->second)
+                overloads.push_back(MakeMethod(klass->fCppType, method, Cppyy::IsStaticMethod(method)));
+            lazy->fMethods.erase(ilm);
+
+            CPPOverload* method = CPPOverload_New(name, overloads);
+            PyObject* pyname = CPyCppyy_PyText_InternFromString(const_cast<char*>(name.c_str()));
+            PyType_Type.tp_setattro(base, pyname, (PyObject*)method);
+            Py_DECREF(pyname);
+            Py_DECREF(method);
+            return true;
+        }
+
+        auto ild = lazy->fDataMembers.find(name);
+        if (ild != lazy->fDataMembers.end()) {
+            Cppyy::TCppScope_t datamember = ild->second;
+            lazy->fDataMembers.erase(ild);
+            AddPropertyToClass(base, klass->fCppType, datamember);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//----------------------------------------------------------------------------
+bool CPyCppyy::ResolveLazyMember(PyObject* pyclass, PyObject* pyname)
+{
+// Walk the MRO from the most derived class: the first class to have the name either
+// already has it in its dictionary (nothing to do), or has it pending (build it).
+    if (!CPyCppyy_PyText_CheckExact(pyname))
+        return false;
+
+    PyObject* mro = ((PyTypeObject*)pyclass)->tp_mro;
+    if (!mro)
+        return false;
+
+    const char* cname = nullptr;
+    Py_ssize_t nbases = PyTuple_GET_SIZE(mro);
+    for (Py_ssize_t ibase = 0; ibase < nbases; ++ibase) {
+        PyObject* base = PyTuple_GET_ITEM(mro, ibase);
+        PyObject* dct = ((PyTypeObject*)base)->tp_dict;
+        if (dct && PyDict_GetItem(dct, pyname))
+            return false;
+
+        if (base == (PyObject*)&CPPInstance_Type || !CPPScope_Check(base))
+            continue;
+
+        CPPScope* klass = (CPPScope*)base;
+        LazyMembers_t* lazy = klass->fLazyMembers;
+        if (!(klass->fFlags & CPPScope::kIsLazy) || !lazy || \
+                (lazy->fMethods.empty() && lazy->fDataMembers.empty()))
+            continue;
+
+        if (!cname) {
+            cname = CPyCppyy_PyText_AsString(pyname);
+            if (!cname || IsPySpecialName(cname))    // specials are never deferred
+                return false;
+        }
+
+        if (BuildLazyMember(base, cname, false))
+            return true;
+    }
+
+    return false;
+}
+
+//----------------------------------------------------------------------------
+void CPyCppyy::BuildLazyMembers(PyObject* pyclass)
+{
+// Add all pending members of pyclass and its bases to their class dictionaries.
+    PyObject* mro = ((PyTypeObject*)pyclass)->tp_mro;
+    Py_ssize_t nbases = mro ? PyTuple_GET_SIZE(mro) : 0;
+    for (Py_ssize_t ibase = 0; ibase < nbases; ++ibase) {
+        PyObject* base = PyTuple_GET_ITEM(mro, ibase);
+        if (base == (PyObject*)&CPPInstance_Type || !CPPScope_Check(base))
+            continue;
+
+        LazyMembers_t* lazy = ((CPPScope*)base)->fLazyMembers;
+        if (!lazy)
+            continue;
+
+        std::vector<std::string> names;
+        for (const auto& lm : lazy->fMethods)     names.push_back(lm.first);
+        for (const auto& ld : lazy->fDataMembers) names.push_back(ld.first);
+        for (const auto& name : names)
+            BuildLazyMember(base, name, false);
+    }
+}
+
+//----------------------------------------------------------------------------
+void CPyCppyy::SetLazyClassBuild(bool lazy)
+{
+// Select lazy building for classes created from here on.
+    gLazyClassBuild = lazy;
+}
+
 //----------------------------------------------------------------------------
 PyObject* CPyCppyy::CreateExcScopeProxy(PyObject* pyscope, PyObject* pyname, PyObject* parent)
 {
@@ -793,25 +1226,22 @@ PyObject* CPyCppyy::CreateExcScopeProxy(PyObject* pyscope, PyObject* pyname, PyO
 
 
 //----------------------------------------------------------------------------
-PyObject* CPyCppyy::BindCppObjectNoCast(Cppyy::TCppObject_t address,
-        Cppyy::TCppScope_t klass, const unsigned flags)
+static PyObject* BindCppObjectToClass(
+    Cppyy::TCppObject_t address, PyObject* pyclass, const unsigned flags)
 {
-// only known or knowable objects will be bound (null object is ok)
-    if (!klass) {
-        PyErr_SetString(PyExc_TypeError, "attempt to bind C++ object w/o class");
-        return nullptr;
-    }
-
-// retrieve python class
-    PyObject* pyclass = CreateScopeProxy(klass);
-    if (!pyclass)
-        return nullptr;                 // error has been set in CreateScopeProxy
+// bind address as an instance of pyclass (borrowed)
+    using namespace CPyCppyy;
 
     bool isRef   = flags & CPPInstance::kIsReference;
     bool isValue = flags & CPPInstance::kIsValue;
 
+// identity tracking may also be switched off for the class, or for the current thread
+    const unsigned noMemReg = ((flags & CPPInstance::kNoMemReg) || \
+        (((CPPClass*)pyclass)->fFlags & CPPScope::kNoMemReg) || MemoryRegulator::IsBypassed()) ? \
+        CPPInstance::kNoMemReg : 0;
+
 // TODO: make sure that a consistent address is used (may have to be done in BindCppObject)
-    if (address && !isValue /* always fresh */ && !(flags & (CPPInstance::kNoWrapConv|CPPInstance::kNoMemReg))) {
+    if (address && !isValue /* always fresh */ && !(flags & CPPInstance::kNoWrapConv) && !noMemReg) {
         PyObject* oldPyObject = MemoryRegulator::RetrievePyObject(
             isRef ? *(void**)address : address, pyclass);
 
@@ -824,32 +1254,36 @@ PyObject* CPyCppyy::BindCppObjectNoCast(Cppyy::TCppObject_t address,
 
 // if smart, instantiate a Python-side object of the underlying type, carrying the smartptr
     PyObject* smart_type = (flags != CPPInstance::kNoWrapConv && (((CPPClass*)pyclass)->fFlags & CPPScope::kIsSmart)) ? pyclass : nullptr;
+    PyObject* underlying = nullptr;
     if (smart_type) {
-        pyclass = CreateScopeProxy(((CPPSmartClass*)smart_type)->fUnderlyingType);
-        if (!pyclass) {
-        // simply restore and expose as the actual smart pointer class
-            pyclass = smart_type;
+        underlying = CreateScopeProxy(((CPPSmartClass*)smart_type)->fUnderlyingType);
+        if (underlying)
+            pyclass = underlying;
+        else {
+        // simply expose as the actual smart pointer class
             smart_type = nullptr;
         }
     }
 
-// instantiate an object of this class
-    PyObject* args = PyTuple_New(0);
+// instantiate an object of this class; op_new does not look at the arguments, but
+// a python-side derived class might
+    static PyObject* sNoArgs = PyTuple_New(0);
     CPPInstance* pyobj =
-        (CPPInstance*)((PyTypeObject*)pyclass)->tp_new((PyTypeObject*)pyclass, args, nullptr);
-    Py_DECREF(args);
+        (CPPInstance*)((PyTypeObject*)pyclass)->tp_new((PyTypeObject*)pyclass, sNoArgs, nullptr);
 
 // bind, register and return if successful
     if (pyobj != 0) { // fill proxy value?
+    // kNoMemReg is kept on the instance, as proxies that are untracked may be re-used
+    // (see the vector iterator)
         unsigned objflags = flags & \
-            (CPPInstance::kIsReference | CPPInstance::kIsPtrPtr | CPPInstance::kIsValue | CPPInstance::kIsOwner | CPPInstance::kIsActual);
-        pyobj->Set(address, (CPPInstance::EFlags)objflags);
+            (CPPInstance::kIsReference | CPPInstance::kIsPtrPtr | CPPInstance::kIsValue | CPPInstance::kIsOwner | CPPInstance::kIsActual | CPPInstance::kNoMemReg);
+        pyobj->Set(address, (CPPInstance::EFlags)(objflags | noMemReg));
 
         if (smart_type)
             pyobj->SetSmart(smart_type);
 
     // do not register null pointers, references (?), or direct usage of smart pointers or iterators
-        if (address && !isRef && !(flags & (CPPInstance::kNoWrapConv|CPPInstance::kNoMemReg)))
+        if (address && !isRef && !(flags & CPPInstance::kNoWrapConv) && !noMemReg)
             MemoryRegulator::RegisterPyObject(pyobj, pyobj->GetObject());
     }
 
@@ -857,12 +1291,95 @@ PyObject* CPyCppyy::BindCppObjectNoCast(Cppyy::TCppObject_t address,
     if (((CPPClass*)pyclass)->fFlags & CPPScope::kIsException) {
         PyObject* exc_obj = CPPExcInstance_Type.tp_new(&CPPExcInstance_Type, nullptr, nullptr);
         ((CPPExcInstance*)exc_obj)->fCppInstance = (PyObject*)pyobj;
-        Py_DECREF(pyclass);
+        Py_XDECREF(underlying);
         return exc_obj;
     }
 
+    Py_XDECREF(underlying);
+    return (PyObject*)pyobj;
+}
+
+//----------------------------------------------------------------------------
+PyObject* CPyCppyy::BindCppObjectNoCast(Cppyy::TCppObject_t address,
+        Cppyy::TCppScope_t klass, const unsigned flags)
+{
+// only known or knowable objects will be bound (null object is ok)
+    if (!klass) {
+        PyErr_SetString(PyExc_TypeError, "attempt to bind C++ object w/o class");
+        return nullptr;
+    }
+
+// retrieve python class
+    PyObject* pyclass = CreateScopeProxy(klass);
+    if (!pyclass)
+        return nullptr;                 // error has been set in CreateScopeProxy
+
+    PyObject* pyobj = BindCppObjectToClass(address, pyclass, flags);
     Py_DECREF(pyclass);
+    return pyobj;
+}
+
+//----------------------------------------------------------------------------
+PyObject* CPyCppyy::BindCppObjectNoCast(Cppyy::TCppObject_t address,
+        PyClassRef& klass, const unsigned flags)
+{
+// as above, but with the python class cached on the caller's side
+#ifdef CPYCPPYY_FREE_THREADED
+    return BindCppObjectNoCast(address, klass.GetScope(), flags);
+#else
+    if (!klass.GetScope()) {
+        PyErr_SetString(PyExc_TypeError, "attempt to bind C++ object w/o class");
+        return nullptr;
+    }
+
+    PyObject* pyclass = klass.Get();
+    if (!pyclass)
+        return nullptr;                 // error has been set in CreateScopeProxy
+
+    return BindCppObjectToClass(address, pyclass, flags);
+#endif
+}
+
+//----------------------------------------------------------------------------
+PyObject* CPyCppyy::BindCppValueInline(Cppyy::TCppObject_t value,
+        PyClassRef& klass, size_t size, const unsigned flags)
+{
+// The caller is expected to have verified that klass is neither smart nor an
+// exception, and that its objects are trivially copyable with an alignment of no
+// more than 16b, so that the object can be relocated with a plain copy.
+    PyObject* pyclass = klass.Get();
+    if (!pyclass)
+        return nullptr;                 // error has been set in CreateScopeProxy
+
+#ifdef CPYCPPYY_INLINE_VALUES
+// allocate the proxy with room for the object, aligned, behind the proxy proper; the
+// extra storage is zeroed and released with the proxy by the type's tp_free
+    PyTypeObject* pytype = (PyTypeObject*)pyclass;
+    const size_t basicsize = (size_t)pytype->tp_basicsize;
+    const size_t offset = (basicsize + 15) & ~(size_t)15;
+    CPPInstance* pyobj = (CPPInstance*)PyUnstable_Object_GC_NewWithExtraData(
+        pytype, offset - basicsize + size);
+
+    if (pyobj) {
+        void* address = (char*)pyobj + offset;
+        memcpy(address, value, size);
+
+        pyobj->fObject = nullptr;
+        unsigned objflags = flags & (CPPInstance::kIsValue | CPPInstance::kIsOwner | CPPInstance::kIsActual);
+        pyobj->Set(address, (CPPInstance::EFlags)(objflags | CPPInstance::kIsInline));
+        PyObject_GC_Track((PyObject*)pyobj);
+
+        if (!(flags & (CPPInstance::kNoWrapConv|CPPInstance::kNoMemReg)) && \
+                !(((CPPClass*)pyclass)->fFlags & CPPScope::kNoMemReg) && !MemoryRegulator::IsBypassed())
+            MemoryRegulator::RegisterPyObject(pyobj, address);
+    }
+
     return (PyObject*)pyobj;
+#else
+    (void)value; (void)size; (void)flags;
+    PyErr_SetString(PyExc_SystemError, "inline storage of values is not supported");
+    return nullptr;
+#endif
 }
 
 //----------------------------------------------------------------------------
@@ -906,6 +1423,18 @@ PyObject* CPyCppyy::BindCppObject(Cppyy::TCppObject_t address,
     return BindCppObjectNoCast(address, klass, new_flags);
 }
 
+//----------------------------------------------------------------------------
+PyObject* CPyCppyy::BindCppObject(Cppyy::TCppObject_t address,
+        PyClassRef& klass, const unsigned flags)
+{
+// as above, for the python class cached on the caller's side; since the actual class
+// is not looked up, there is no down-cast to consider
+    if (address && !(flags & CPPInstance::kIsReference) &&
+            (gPinnedTypes.empty() || gPinnedTypes.find(klass.GetScope()) == gPinnedTypes.end()))
+        return BindCppObjectNoCast(address, klass, flags | CPPInstance::kIsActual);
+    return BindCppObjectNoCast(address, klass, flags);
+}
+
 //----------------------------------------------------------------------------
 PyObject* CPyCppyy::BindCppObjectArray(
     Cppyy::TCppObject_t address, Cppyy::TCppScope_t klass, cdims_t dims)
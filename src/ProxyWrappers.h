@@ -5,6 +5,7 @@
 #include "Dimensions.h"
 
 // Standard
+#include <stdint.h>
 #include <string>
 
 
@@ -20,11 +21,71 @@ PyObject* CreateScopeProxy(Cppyy::TCppScope_t scope, PyObject* parent = nullptr,
 // C++ exceptions form a special case b/c they have to derive from BaseException
 PyObject* CreateExcScopeProxy(PyObject* pyscope, PyObject* pyname, PyObject* parent);
 
+// materialize members of lazily built classes (see CPPScope::kIsLazy): the named
+// one, found on the class or (if inherited) its bases, or all members pending
+bool BuildLazyMember(PyObject* pyclass, const std::string& name, bool inherited = true);
+void BuildLazyMembers(PyObject* pyclass);
+
+// materialize the member pyname of pyclass if it is still pending on the class that
+// would provide it, i.e. if no class earlier in the MRO has it already; to be called
+// ahead of a generic lookup, so that a base member can not hide a pending one
+bool ResolveLazyMember(PyObject* pyclass, PyObject* pyname);
+
+// build classes lazily, i.e. add methods and data members on first use
+void SetLazyClassBuild(bool lazy);
+
+// reference to the python class of a C++ class, for binding objects on hot paths (such
+// as in executors and converters) without looking up the class each time; the reference
+// is borrowed (a strong one would keep the class alive through the converters of its own
+// methods), and re-resolved after the class registry replaced or removed an entry, which
+// it does before a registered class goes away
+class PyClassRef {
+public:
+    explicit PyClassRef(Cppyy::TCppScope_t klass) :
+        fScope(klass), fPyClass(nullptr), fGeneration(0), fIsOwner(false) {}
+    PyClassRef(const PyClassRef& other) :
+        fScope(other.fScope), fPyClass(nullptr), fGeneration(0), fIsOwner(false) {}
+    PyClassRef& operator=(const PyClassRef&) = delete;
+    ~PyClassRef();
+
+public:
+    Cppyy::TCppScope_t GetScope() const { return fScope; }
+    PyObject* Get();        // borrowed; nullptr, w/ python error set, on failure
+
+private:
+    Cppyy::TCppScope_t fScope;
+    PyObject*          fPyClass;
+    uint64_t           fGeneration;
+    bool               fIsOwner;    // only if the class is not held anywhere else
+};
+
 // bind a C++ object into a Python proxy object (flags are CPPInstance::Default)
 PyObject* BindCppObjectNoCast(Cppyy::TCppObject_t object,
     Cppyy::TCppScope_t klass, const unsigned flags = 0);
+PyObject* BindCppObjectNoCast(Cppyy::TCppObject_t object,
+    PyClassRef& klass, const unsigned flags = 0);
 PyObject* BindCppObject(Cppyy::TCppObject_t object,
     Cppyy::TCppScope_t klass, const unsigned flags = 0);
+PyObject* BindCppObject(Cppyy::TCppObject_t object,
+    PyClassRef& klass, const unsigned flags = 0);
+
+// bind a copy of the trivially copyable object at value, of the given size, into
+// storage allocated as part of the proxy (see CPPInstance::kIsInline); the caller
+// keeps ownership of value
+PyObject* BindCppValueInline(Cppyy::TCppObject_t value,
+    PyClassRef& klass, size_t size, const unsigned flags = 0);
+
+// upper limit on the size of objects returned by value to be stored inline
+#ifndef CPYCPPYY_INLINE_MAXSIZE
+#define CPYCPPYY_INLINE_MAXSIZE 64
+#endif
+
+// allocating a proxy with extra storage requires p3.12 (earlier versions only allow
+// the size of an allocation to follow from the type); inline storage is off otherwise
+#if PY_VERSION_HEX >= 0x030C0000
+#define CPYCPPYY_INLINE_VALUES 1
+#endif
+
 PyObject* BindCppObjectArray(
     Cppyy::TCppObject_t address, Cppyy::TCppScope_t klass, cdims_t dims);
 
@@ -41,6 +41,11 @@ public:
 public:
     virtual PyObject* Call(CPPInstance*& self,
         CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds, CallContext* ctxt = nullptr) = 0;
+
+// side-effect free estimate of whether Call() can convert the given arguments, for
+// use in overload resolution (kMatchImpossible only if Call() is certain to fail)
+    virtual EMatch Match(CPPInstance* /* self */,
+        CPyCppyy_PyArgs_t /* args */, size_t /* nargsf */, PyObject* /* kwds */) { return kMatchUnknown; }
 };
 
 } // namespace CPyCppyy
@@ -10,16 +10,20 @@
 #include "ProxyWrappers.h"
 #include "PyCallable.h"
 #include "PyStrings.h"
+#include "Threading.h"
 #include "TypeManip.h"
 #include "Utility.h"
+#include "VectorCall.h"
 
 // Standard
 #include <algorithm>
 #include <complex>
+#include <map>
 #include <set>
 #include <stdexcept>
 #include <sstream>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 
@@ -38,6 +42,7 @@ using namespace CPyCppyy;
 bool HasAttrDirect(PyObject* pyclass, PyObject* pyname, bool mustBeCPyCppyy = false) {
 // prevents calls to Py_TYPE(pyclass)->tp_getattr, which is unnecessary for our
 // purposes here and could tickle problems w/ spurious lookups into ROOT meta
+    BuildLazyMember(pyclass, CPyCppyy_PyText_AsString(pyname), false);
     PyObject* dct = PyObject_GetAttr(pyclass, PyStrings::gDict);
     if (dct) {
         PyObject* attr = PyObject_GetItem(dct, pyname);
@@ -54,6 +59,7 @@ bool HasAttrDirect(PyObject* pyclass, PyObject* pyname, bool mustBeCPyCppyy = fa
 
 PyObject* GetAttrDirect(PyObject* pyclass, PyObject* pyname) {
 // get an attribute without causing getattr lookups
+    BuildLazyMember(pyclass, CPyCppyy_PyText_AsString(pyname), false);
     PyObject* dct = PyObject_GetAttr(pyclass, PyStrings::gDict);
     if (dct) {
         PyObject* attr = PyObject_GetItem(dct, pyname);
@@ -304,12 +310,134 @@ static ItemGetter* GetGetter(PyObject* args)
     return getter;
 }
 
+static bool ResizeVector(PyObject* vecin, Py_ssize_t sz)
+{
+    PyObject* res = PyObject_CallMethod(vecin, (char*)"resize", (char*)"n", sz);
+    Py_XDECREF(res);
+    return (bool)res;
+}
+
+static Cppyy::TCppType_t NativeValueType(PyObject* pyclass, std::string& vtname, size_t& stride)
+{
+// value_type of the vector class if its elements can be written directly (see below)
+    PyObject* pyvalue_type = GetAttrDirect(pyclass, PyStrings::gValueType);
+    if (!pyvalue_type || !PyLong_Check(pyvalue_type)) {
+        if (!pyvalue_type) PyErr_Clear();
+        Py_XDECREF(pyvalue_type);
+        return (Cppyy::TCppType_t)0;
+    }
+    Cppyy::TCppType_t value_type = PyLong_AsVoidPtr(pyvalue_type);
+    Py_DECREF(pyvalue_type);
+
+    vtname = Cppyy::GetTypeAsString(value_type);
+    const std::string& cpd = TypeManip::compound(vtname);
+    if (cpd.empty() ? !Cppyy::IsBuiltin(vtname) : \
+            (cpd != "*" || !Cppyy::GetScope(TypeManip::clean_type(vtname))))
+        return (Cppyy::TCppType_t)0;
+
+    stride = Cppyy::SizeOfType(value_type);
+    return stride ? value_type : (Cppyy::TCppType_t)0;
+}
+
+static bool IsNativeBuffer(PyObject* pyobject)
+{
+    return PyObject_CheckBuffer(pyobject) && \
+        !(CPyCppyy_PyText_Check(pyobject) || PyBytes_Check(pyobject));
+}
+
+static bool GetNativeBuffer(PyObject* pyobject, const std::string& vtname, Py_buffer& view)
+{
+// acquire a buffer that can be copied from as-is into an array of vtname
+    if (PyObject_GetBuffer(pyobject, &view, PyBUF_FORMAT | PyBUF_STRIDES) != 0) {
+        PyErr_Clear();
+        return false;
+    }
+    if (!IsScalarBufferCopyable(vtname, view)) {
+        PyBuffer_Release(&view);
+        return false;
+    }
+    return true;
+}
+
+static int FillVectorNative(PyObject* vecin, PyObject* pyseq)
+{
+// Fill the vector directly in its storage, bypassing push_back: buffers of builtin
+// scalars are copied in typed loops, list and tuple items are converted in place by
+// the converter of the value_type. Only builtin and class pointer value types qualify,
+// as objects by-value may need (implicit) construction. Returns 1 on success, 0 if
+// not applicable (no error set, vector unchanged), and -1 on error.
+    const bool isBuffer = !(PyTuple_CheckExact(pyseq) || PyList_CheckExact(pyseq));
+    if (isBuffer && !IsNativeBuffer(pyseq))
+        return 0;
+
+    std::string vtname; size_t stride = 0;
+    Cppyy::TCppType_t value_type = NativeValueType((PyObject*)Py_TYPE(vecin), vtname, stride);
+    if (!value_type)
+        return 0;
+
+    Py_buffer view;
+    Py_ssize_t nelem = 0;
+    if (isBuffer) {
+        if (!GetNativeBuffer(pyseq, vtname, view))
+            return 0;
+        nelem = view.len / view.itemsize;
+    } else
+        nelem = PySequence_Fast_GET_SIZE(pyseq);
+
+    Py_ssize_t oldsz = PySequence_Size(vecin);
+    if (oldsz < 0 || !ResizeVector(vecin, oldsz + nelem)) {
+        if (isBuffer) PyBuffer_Release(&view);
+        return -1;
+    }
+
+    void* data = nullptr;
+    PyObject* pydata = CallPyObjMethod(vecin, "__real_data");
+    if (!pydata || Utility::GetBuffer(pydata, '*', 1, data, false) == 0)
+        data = nullptr;
+    Py_XDECREF(pydata);
+    PyErr_Clear();
+
+    int result = data ? 1 : 0;
+    if (data) {
+        char* start = (char*)data + oldsz*stride;
+        if (isBuffer)
+            CopyScalarBuffer(vtname, start, view);
+        else {
+            Converter* conv = AcquireConverter(value_type);
+            PyObject** items = PySequence_Fast_ITEMS(pyseq);
+            for (Py_ssize_t i = 0; i < nelem; ++i) {
+                if (!conv->ToMemory(items[i], start + i*stride)) {
+                // leave it to push_back to resolve (or report) the conversion
+                    PyErr_Clear();
+                    result = 0;
+                    break;
+                }
+            }
+            ReleaseConverter(conv);
+        }
+    }
+    if (isBuffer) PyBuffer_Release(&view);
+
+// restore the original size if not all data was written
+    if (result != 1 && !ResizeVector(vecin, oldsz))
+        return -1;
+
+    return result;
+}
+
 static bool FillVector(PyObject* vecin, PyObject* args, ItemGetter* getter)
 {
     Py_ssize_t sz = getter->size();
     if (sz < 0)
         return false;
 
+// fast path for builtin and pointer value types, without calls through python
+    if (0 < sz) {
+        int native = FillVectorNative(vecin, PyTuple_GET_ITEM(args, 0));
+        if (native)
+            return native == 1;
+    }
+
 // reserve memory as applicable
     if (0 < sz) {
         PyObject* res = PyObject_CallMethod(vecin, (char*)"reserve", (char*)"n", sz);
@@ -428,11 +556,19 @@ PyObject* VectorIAdd(PyObject* self, PyObject* args, PyObject* /* kwds */)
         return self;
     }
 
-// if no getter, it could still be b/c we have a buffer (e.g. numpy); looping over
-// a buffer here is slow, so use insert() instead
+// if no getter, it could still be b/c we have a buffer (e.g. numpy); copy the data
+// directly if possible, otherwise use insert() rather than looping over the buffer
     if (PyTuple_GET_SIZE(args) == 1) {
         PyObject* fi = PyTuple_GET_ITEM(args, 0);
-        if (PyObject_CheckBuffer(fi) && !(CPyCppyy_PyText_Check(fi) || PyBytes_Check(fi))) {
+        int native = FillVectorNative(self, fi);
+        if (native) {
+            if (native < 0)
+                return nullptr;
+            Py_INCREF(self);
+            return self;
+        }
+
+        if (IsNativeBuffer(fi)) {
             PyObject* vend = PyObject_CallMethodNoArgs(self, PyStrings::gEnd);
             if (vend) {
                 PyObject* result = PyObject_CallMethodObjArgs(self, PyStrings::gInsert, vend, fi, nullptr);
@@ -477,6 +613,25 @@ PyObject* VectorInit(PyObject* self, PyObject* args, PyObject* /* kwds */)
         return result;
     }
 
+// buffers of builtin scalars are copied directly into a default constructed vector
+    if (PyTuple_GET_SIZE(args) == 1 && IsNativeBuffer(PyTuple_GET_ITEM(args, 0))) {
+        std::string vtname; size_t stride = 0; Py_buffer view;
+        if (NativeValueType((PyObject*)Py_TYPE(self), vtname, stride) && \
+                GetNativeBuffer(PyTuple_GET_ITEM(args, 0), vtname, view)) {
+            PyBuffer_Release(&view);
+            PyObject* result = PyObject_CallMethodNoArgs(self, PyStrings::gRealInit);
+            if (!result)
+                return nullptr;
+
+            if (FillVectorNative(self, PyTuple_GET_ITEM(args, 0)) == 1)
+                return result;
+            Py_DECREF(result);
+            if (!PyErr_Occurred())
+                PyErr_SetString(PyExc_TypeError, "could not fill vector from buffer");
+            return nullptr;
+        }
+    }
+
 // The given argument wasn't iterable: simply forward to regular constructor
     PyObject* realInit = PyObject_GetAttr(self, PyStrings::gRealInit);
     if (realInit) {
@@ -488,12 +643,102 @@ PyObject* VectorInit(PyObject* self, PyObject* args, PyObject* /* kwds */)
     return nullptr;
 }
 
+//---------------------------------------------------------------------------
+// checks that the vector at vec still holds its elements at buf, and at least n of them
+typedef bool (*vecview_check_t)(void* vec, void* buf, size_t n);
+
+struct VectorAccess_t {
+    Cppyy::TCppMethod_t fData = (Cppyy::TCppMethod_t)0;
+    Cppyy::TCppMethod_t fSize = (Cppyy::TCppMethod_t)0;
+    vecview_check_t     fCheck = nullptr;
+};
+
+static Cppyy::TCppMethod_t FindNoArgsMethod(Cppyy::TCppScope_t scope, const std::string& name)
+{
+    for (auto method : Cppyy::GetMethodsFromName(scope, name)) {
+        if (Cppyy::GetMethodNumArgs(method) == 0)
+            return method;
+    }
+    return (Cppyy::TCppMethod_t)0;
+}
+
+static const VectorAccess_t& GetVectorAccess(Cppyy::TCppScope_t scope)
+{
+// data() and size() of vector classes, for direct calls when checking views; views
+// are checked on every access, so a JITed checker that inlines both is preferred
+    BindingsLockGuard_t lock(gBindingsLock);
+    static std::map<Cppyy::TCppScope_t, VectorAccess_t> sAccess;
+    auto va = sAccess.find(scope);
+    if (va == sAccess.end()) {
+        VectorAccess_t acc;
+        acc.fData = FindNoArgsMethod(scope, "data");
+        acc.fSize = FindNoArgsMethod(scope, "size");
+        if (acc.fData && acc.fSize) {
+            static int sCount = 0;
+            const std::string& fname = "vecview_check" + std::to_string(sCount++);
+            std::ostringstream code;
+            code << "namespace __cppyy_internal {\n"
+                    "bool " << fname << "(void* v, void* buf, size_t n) {\n"
+                    "  typedef " << Cppyy::GetScopedFinalName(scope) << " C;\n"
+                    "  return (void*)((C*)v)->data() == buf && n <= ((C*)v)->size();\n"
+                    "} }";
+            if (Cppyy::Compile(code.str(), true /* silent */)) {
+                const auto& methods = Cppyy::GetMethodsFromName(Cppyy::GetScope("__cppyy_internal"), fname);
+                if (!methods.empty())
+                    acc.fCheck = (vecview_check_t)Cppyy::GetFunctionAddress(methods[0], false);
+            }
+        }
+        va = sAccess.emplace(scope, acc).first;
+    }
+    return va->second;
+}
+
+static bool GetVectorStorage(PyObject* pyvec, void*& data, Py_ssize_t& size)
+{
+    CPPInstance* vec = (CPPInstance*)pyvec;
+    void* obj = vec->GetObject();
+    const VectorAccess_t& acc = GetVectorAccess(vec->ObjectIsA());
+    if (!obj || !acc.fData || !acc.fSize)
+        return false;
+
+    data = Cppyy::CallR(acc.fData, obj, 0, nullptr);
+    size = (Py_ssize_t)Cppyy::CallL(acc.fSize, obj, 0, nullptr);
+    return true;
+}
+
+static bool VectorViewIsValid(LowLevelView* view)
+{
+// a view on the vector's storage is stale once the vector is gone, has reallocated,
+// or has shrunk below the view's size; growth within the capacity leaves it valid
+    void* obj = ((CPPInstance*)view->fController)->GetObject();
+    if (!obj)
+        return false;
+
+    Py_ssize_t vlen = view->fBufInfo.itemsize ? view->fBufInfo.len / view->fBufInfo.itemsize : 0;
+    if (view->fIsValidArg)      // checker cached on the view, see VectorData()
+        return ((vecview_check_t)view->fIsValidArg)(obj, view->fBufInfo.buf, (size_t)vlen);
+
+    void* data = nullptr; Py_ssize_t size = 0;
+    if (!GetVectorStorage(view->fController, data, size))
+        return true;
+    return data == view->fBufInfo.buf && vlen <= size;
+}
+
 //---------------------------------------------------------------------------
 PyObject* VectorData(PyObject* self, PyObject*)
 {
     PyObject* pydata = CallPyObjMethod(self, "__real_data");
     if (!LowLevelView_Check(pydata)) return pydata;
 
+// pin the vector, and have the view check for reallocations on access
+    LowLevelView* llview = (LowLevelView*)pydata;
+    if (!llview->fController) {
+        Py_INCREF(self);
+        llview->fController = self;
+        llview->fIsValid = VectorViewIsValid;
+        llview->fIsValidArg = (void*)GetVectorAccess(((CPPInstance*)self)->ObjectIsA()).fCheck;
+    }
+
     PyObject* pylen = PyObject_CallMethodNoArgs(self, PyStrings::gSize);
     if (!pylen) {
         PyErr_Clear();
@@ -523,6 +768,250 @@ PyObject* VectorArray(PyObject* self, PyObject* /* args */)
 }
 
 
+//---------------------------------------------------------------------------
+struct ArrayElement_t {
+    char    fKind;      // as in numpy's typestr: 'b', 'i', 'u', 'f', 'c'
+    uint8_t fDLCode;    // DLPack's DLDataTypeCode
+    size_t  fSize;
+};
+
+static bool GetArrayElement(const std::string& cppname, ArrayElement_t& elem)
+{
+// description of builtin arithmetic types for array exports
+    static const std::map<std::string, ArrayElement_t> sElements = {
+        {"bool",                 {'b', 6, sizeof(bool)}},
+        {"char",                 {std::is_signed<char>::value ? 'i' : 'u',
+                                  (uint8_t)(std::is_signed<char>::value ? 0 : 1), sizeof(char)}},
+        {"signed char",          {'i', 0, sizeof(signed char)}},
+        {"unsigned char",        {'u', 1, sizeof(unsigned char)}},
+        {"short",                {'i', 0, sizeof(short)}},
+        {"unsigned short",       {'u', 1, sizeof(unsigned short)}},
+        {"int",                  {'i', 0, sizeof(int)}},
+        {"unsigned int",         {'u', 1, sizeof(unsigned int)}},
+        {"long",                 {'i', 0, sizeof(long)}},
+        {"unsigned long",        {'u', 1, sizeof(unsigned long)}},
+        {"long long",            {'i', 0, sizeof(long long)}},
+        {"unsigned long long",   {'u', 1, sizeof(unsigned long long)}},
+        {"float",                {'f', 2, sizeof(float)}},
+        {"double",               {'f', 2, sizeof(double)}},
+        {"std::complex<float>",  {'c', 5, sizeof(std::complex<float>)}},
+        {"std::complex<double>", {'c', 5, sizeof(std::complex<double>)}}
+    };
+
+    auto e = sElements.find(cppname);
+    if (e == sElements.end())
+        e = sElements.find(Cppyy::ResolveName(cppname));
+    if (e == sElements.end())
+        return false;
+    elem = e->second;
+    return true;
+}
+
+static std::string ArrayTypeStr(char kind, size_t size)
+{
+    const char order = size == 1 ? '|' : (PY_LITTLE_ENDIAN ? '<' : '>');
+    return std::string(1, order) + kind + std::to_string(size);
+}
+
+static PyObject* ArrayDescrEntry(const std::string& name, const std::string& typestr)
+{
+    return Py_BuildValue("(ss)", name.c_str(), typestr.c_str());
+}
+
+static PyObject* StructDescr(Cppyy::TCppScope_t scope, size_t size)
+{
+// numpy record description of a plain struct with only (public) builtin arithmetic
+// data members; padding is described by unnamed void fields
+    if (!Cppyy::IsAggregate(scope) || Cppyy::GetNumBases(scope) != 0)
+        return nullptr;
+
+    std::vector<std::pair<intptr_t, Cppyy::TCppScope_t>> fields;
+    for (auto datamember : Cppyy::GetDatamembers(scope)) {
+        if (Cppyy::IsStaticDatamember(datamember))
+            continue;
+        fields.emplace_back(Cppyy::GetDatamemberOffset(datamember), datamember);
+    }
+    if (fields.empty())
+        return nullptr;
+    std::sort(fields.begin(), fields.end(),
+        [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    PyObject* descr = PyList_New(0);
+    size_t pos = 0;
+    for (const auto& f : fields) {
+        ArrayElement_t elem;
+        if (!Cppyy::IsPublicData(f.second) || (size_t)f.first < pos || \
+                !GetArrayElement(Cppyy::GetDatamemberTypeAsString(f.second), elem)) {
+            Py_DECREF(descr);
+            return nullptr;
+        }
+        if (pos < (size_t)f.first)
+            PyList_Append(descr, ArrayDescrEntry("", ArrayTypeStr('V', f.first - pos)));
+        PyObject* entry = ArrayDescrEntry(Cppyy::GetFinalName(f.second), ArrayTypeStr(elem.fKind, elem.fSize));
+        PyList_Append(descr, entry);
+        Py_DECREF(entry);
+        pos = f.first + elem.fSize;
+    }
+    if (size < pos) {
+        Py_DECREF(descr);
+        return nullptr;
+    }
+    if (pos < size) {
+        PyObject* entry = ArrayDescrEntry("", ArrayTypeStr('V', size - pos));
+        PyList_Append(descr, entry);
+        Py_DECREF(entry);
+    }
+
+    return descr;
+}
+
+static Cppyy::TCppType_t VectorValueType(PyObject* self)
+{
+    PyObject* pyvalue_type = GetAttrDirect((PyObject*)Py_TYPE(self), PyStrings::gValueType);
+    Cppyy::TCppType_t value_type = (Cppyy::TCppType_t)0;
+    if (pyvalue_type && PyLong_Check(pyvalue_type))
+        value_type = PyLong_AsVoidPtr(pyvalue_type);
+    else
+        PyErr_Clear();
+    Py_XDECREF(pyvalue_type);
+    return value_type;
+}
+
+PyObject* VectorArrayInterface(PyObject* self, void*)
+{
+// Zero-copy export of vectors of builtin arithmetic types or plain structs through
+// numpy's array interface; arrays created from it keep the vector alive, but, as for
+// any pointer to its data, do not survive reallocation of the vector
+    Cppyy::TCppType_t value_type = VectorValueType(self);
+    if (!value_type) {
+        PyErr_SetString(PyExc_AttributeError, "__array_interface__");
+        return nullptr;
+    }
+
+    const std::string& vtname = Cppyy::GetTypeAsString(value_type);
+    ArrayElement_t elem;
+    std::string typestr;
+    PyObject* descr = nullptr;
+    if (GetArrayElement(vtname, elem))
+        typestr = ArrayTypeStr(elem.fKind, elem.fSize);
+    else {
+        Cppyy::TCppScope_t scope = Cppyy::GetScope(vtname);
+        size_t size = scope ? Cppyy::SizeOf(scope) : 0;
+        descr = size ? StructDescr(scope, size) : nullptr;
+        if (!descr) {
+            PyErr_Format(PyExc_AttributeError,
+                "__array_interface__ (value type %s is not arithmetic or a plain struct)", vtname.c_str());
+            return nullptr;
+        }
+        typestr = ArrayTypeStr('V', size);
+    }
+
+    void* data = nullptr; Py_ssize_t size = 0;
+    if (!GetVectorStorage(self, data, size)) {
+        Py_XDECREF(descr);
+        PyErr_SetString(PyExc_AttributeError, "__array_interface__ (no access to vector data)");
+        return nullptr;
+    }
+
+    PyObject* pyinterface = Py_BuildValue("{s:(n),s:s,s:(NO),s:i}",
+        "shape", size, "typestr", typestr.c_str(),
+        "data", PyLong_FromVoidPtr(data), Py_False, "version", 3);
+    if (pyinterface && descr)
+        PyDict_SetItemString(pyinterface, "descr", descr);
+    Py_XDECREF(descr);
+    return pyinterface;
+}
+
+PyGetSetDef VectorArrayInterfaceDef{(char*)"__array_interface__",
+    (getter)VectorArrayInterface, nullptr, (char*)"numpy array interface (zero-copy)", nullptr};
+
+//---------------------------------------------------------------------------
+// DLPack tensor exchange (only the, ABI stable, structures needed for export)
+struct DLDevice_t   { int32_t fDeviceType; int32_t fDeviceId; };
+struct DLDataType_t { uint8_t fCode; uint8_t fBits; uint16_t fLanes; };
+struct DLTensor_t {
+    void*        fData;
+    DLDevice_t   fDevice;
+    int32_t      fNDim;
+    DLDataType_t fDType;
+    int64_t*     fShape;
+    int64_t*     fStrides;
+    uint64_t     fByteOffset;
+};
+struct DLManagedTensor_t {
+    DLTensor_t fTensor;
+    void*      fManagerCtx;
+    void     (*fDeleter)(DLManagedTensor_t*);
+};
+
+struct VectorDLTensor_t {
+    DLManagedTensor_t fManaged;
+    int64_t           fShape[1];
+};
+
+static const int32_t kDLCPU = 1;
+
+static void VectorDLTensorDeleter(DLManagedTensor_t* managed)
+{
+// called by the consumer, which may not hold the GIL
+    PyGILState_STATE state = PyGILState_Ensure();
+    Py_DECREF((PyObject*)managed->fManagerCtx);
+    delete (VectorDLTensor_t*)managed;
+    PyGILState_Release(state);
+}
+
+static void VectorDLCapsuleDestructor(PyObject* capsule)
+{
+// only if not consumed (which renames the capsule) is the tensor still ours
+    if (PyCapsule_IsValid(capsule, "dltensor")) {
+        DLManagedTensor_t* managed = (DLManagedTensor_t*)PyCapsule_GetPointer(capsule, "dltensor");
+        managed->fDeleter(managed);
+    }
+}
+
+PyObject* VectorDLPack(PyObject* self, PyObject* /* args */, PyObject* /* kwds */)
+{
+// Zero-copy export of vectors of builtin arithmetic types as a DLPack capsule (only
+// CPU, so the stream argument, if any, is ignored); the vector is kept alive until
+// the consumer releases the tensor
+    Cppyy::TCppType_t value_type = VectorValueType(self);
+    ArrayElement_t elem;
+    if (!value_type || !GetArrayElement(Cppyy::GetTypeAsString(value_type), elem)) {
+        PyErr_SetString(PyExc_BufferError, "DLPack export requires a builtin arithmetic value type");
+        return nullptr;
+    }
+
+    void* data = nullptr; Py_ssize_t size = 0;
+    if (!GetVectorStorage(self, data, size)) {
+        PyErr_SetString(PyExc_BufferError, "no access to vector data");
+        return nullptr;
+    }
+
+    VectorDLTensor_t* dlt = new VectorDLTensor_t{};
+    dlt->fShape[0] = (int64_t)size;
+    DLTensor_t& tensor = dlt->fManaged.fTensor;
+    tensor.fData    = data;
+    tensor.fDevice  = DLDevice_t{kDLCPU, 0};
+    tensor.fNDim    = 1;
+    tensor.fDType   = DLDataType_t{elem.fDLCode, (uint8_t)(8*elem.fSize), 1};
+    tensor.fShape   = dlt->fShape;
+    tensor.fStrides = nullptr;           // i.e. compact, row-major
+    Py_INCREF(self);
+    dlt->fManaged.fManagerCtx = self;
+    dlt->fManaged.fDeleter = VectorDLTensorDeleter;
+
+    PyObject* capsule = PyCapsule_New(&dlt->fManaged, "dltensor", VectorDLCapsuleDestructor);
+    if (!capsule)
+        VectorDLTensorDeleter(&dlt->fManaged);
+    return capsule;
+}
+
+PyObject* VectorDLPackDevice(PyObject* /* self */, PyObject* /* args */)
+{
+    return Py_BuildValue("(ii)", kDLCPU, 0);
+}
+
+
 //-----------------------------------------------------------------------------
 static PyObject* vector_iter(PyObject* v) {
     vectoriterobject* vi = PyObject_GC_New(vectoriterobject, &VectorIter_Type);
@@ -530,6 +1019,7 @@ static PyObject* vector_iter(PyObject* v) {
 
     Py_INCREF(v);
     vi->ii_container = v;
+    vi->vi_recycle[0] = vi->vi_recycle[1] = nullptr;
 
 // tell the iterator code to set a life line if this container is a temporary
     vi->vi_flags = vectoriterobject::kDefault;
@@ -990,6 +1480,92 @@ PyObject* STLSequenceIter(PyObject* self)
     return iter;
 }
 
+//- native iteration over node-based containers and deques ---------------------
+struct STLIterInfo_t {
+    stliterstep_t     fStep = nullptr;
+    Cppyy::TCppType_t fValueType = (Cppyy::TCppType_t)0;
+};
+
+static const STLIterInfo_t& GetSTLIterInfo(Cppyy::TCppScope_t scope)
+{
+// JIT, once per container class, a function that steps a C++ iterator over the
+// container, one element at a time (see stliterstep_t)
+    BindingsLockGuard_t lock(gBindingsLock);
+    static std::map<Cppyy::TCppScope_t, STLIterInfo_t> sInfos;
+    auto info = sInfos.find(scope);
+    if (info != sInfos.end())
+        return info->second;
+
+    STLIterInfo_t& si = sInfos[scope];
+    Cppyy::TCppType_t value_type = Cppyy::ResolveType(
+        Cppyy::GetTypeFromScope(Cppyy::GetNamed("value_type", scope)));
+    if (!value_type)
+        return si;
+
+    static int sCount = 0;
+    const std::string& fname = "stliter_step" + std::to_string(sCount++);
+    std::ostringstream code;
+    code << "namespace __cppyy_internal {\n"
+            "int " << fname << "(void* c, void** state, void** address) {\n"
+            "  typedef " << Cppyy::GetScopedFinalName(scope) << " C;\n"
+            "  struct S { decltype(((C*)c)->begin()) it; size_t size; };\n"
+            "  S*& s = *(S**)state;\n"
+            "  if (!c) { delete s; s = nullptr; return 0; }\n"
+            "  if (!s) s = new S{((C*)c)->begin(), ((C*)c)->size()};\n"
+            "  else if (s->size != ((C*)c)->size()) return -1;\n"
+            "  if (s->it == ((C*)c)->end()) return 0;\n"
+            "  *address = (void*)&(*s->it);\n"
+            "  ++s->it;\n"
+            "  return 1;\n"
+            "} }";
+
+    if (Cppyy::Compile(code.str(), true /* silent */)) {
+        Cppyy::TCppScope_t cis = Cppyy::GetScope("__cppyy_internal");
+        const auto& methods = Cppyy::GetMethodsFromName(cis, fname);
+        if (!methods.empty()) {
+            si.fStep = (stliterstep_t)Cppyy::GetFunctionAddress(methods[0], false);
+            si.fValueType = value_type;
+        }
+    }
+
+    return si;
+}
+
+PyObject* STLNativeIter(PyObject* self)
+{
+// Implement python's __iter__ for maps, sets, lists, and deques, with the C++ iterator
+// stepped natively; elements are converted (builtins) or bound by reference (objects)
+// as for vectors. Falls back on the generic STL iterator protocol if the stepping
+// function can not be generated.
+    if (!CPPInstance_Check(self) || !((CPPInstance*)self)->GetObject())
+        return STLSequenceIter(self);
+
+    const STLIterInfo_t& info = GetSTLIterInfo(((CPPInstance*)self)->ObjectIsA());
+    if (!info.fStep)
+        return STLSequenceIter(self);
+
+    stliterobject* si = PyObject_GC_New(stliterobject, &STLIter_Type);
+    if (!si) return nullptr;
+
+    Py_INCREF(self);
+    si->ii_container = self;
+    si->ii_pos       = 0;
+    si->ii_len       = 0;
+    si->vi_data      = nullptr;
+    si->vi_stride    = 0;
+    si->vi_recycle[0] = si->vi_recycle[1] = nullptr;
+    si->si_step      = info.fStep;
+    si->si_state     = nullptr;
+
+// elements are always held by-value, so bound objects need a life line
+    si->vi_klass = Cppyy::GetScopeFromType(info.fValueType);
+    si->vi_converter = si->vi_klass ? nullptr : CreateConverter(info.fValueType);
+    si->vi_flags = si->vi_klass ? vectoriterobject::kNeedLifeLine : vectoriterobject::kDefault;
+
+    PyObject_GC_Track(si);
+    return (PyObject*)si;
+}
+
 //- generic iterator support over a sequence with operator[] and size ---------
 //-----------------------------------------------------------------------------
 static PyObject* index_iter(PyObject* c) {
@@ -1773,8 +2349,13 @@ bool CPyCppyy::Pythonize(PyObject* pyclass, Cppyy::TCppScope_t scope)
             Utility::AddToClass(pyclass, "__real_data", "data");
             Utility::AddToClass(pyclass, "data", (PyCFunction)VectorData);
 
-        // numpy array conversion
+        // numpy array conversion, and zero-copy exports
             Utility::AddToClass(pyclass, "__array__", (PyCFunction)VectorArray);
+            PyObject* pyai = PyDescr_NewGetSet((PyTypeObject*)pyclass, &VectorArrayInterfaceDef);
+            PyObject_SetAttrString(pyclass, "__array_interface__", pyai);
+            Py_DECREF(pyai);
+            Utility::AddToClass(pyclass, "__dlpack__", (PyCFunction)VectorDLPack, METH_VARARGS | METH_KEYWORDS);
+            Utility::AddToClass(pyclass, "__dlpack_device__", (PyCFunction)VectorDLPackDevice, METH_NOARGS);
 
         // checked getitem
             if (HasAttrDirect(pyclass, PyStrings::gLen)) {
@@ -1833,6 +2414,18 @@ bool CPyCppyy::Pythonize(PyObject* pyclass, Cppyy::TCppScope_t scope)
         Utility::AddToClass(pyclass, "__len__", (PyCFunction)ReturnTwo, METH_NOARGS);
     }
 
+    if (IsTemplatedSTLClass(name, "map") || IsTemplatedSTLClass(name, "unordered_map") ||
+        IsTemplatedSTLClass(name, "multimap") || IsTemplatedSTLClass(name, "unordered_multimap") ||
+        IsTemplatedSTLClass(name, "set") || IsTemplatedSTLClass(name, "unordered_set") ||
+        IsTemplatedSTLClass(name, "multiset") || IsTemplatedSTLClass(name, "unordered_multiset") ||
+        IsTemplatedSTLClass(name, "list") || IsTemplatedSTLClass(name, "deque")) {
+    // step the C++ iterators natively, rather than through python
+        if (((PyTypeObject*)pyclass)->tp_iter == (getiterfunc)STLSequenceIter) {
+            ((PyTypeObject*)pyclass)->tp_iter = (getiterfunc)STLNativeIter;
+            Utility::AddToClass(pyclass, "__iter__", (PyCFunction)STLNativeIter, METH_NOARGS);
+        }
+    }
+
     if (IsTemplatedSTLClass(name, "shared_ptr") || IsTemplatedSTLClass(name, "unique_ptr")) {
         Utility::AddToClass(pyclass, "__real_init", "__init__");
         Utility::AddToClass(pyclass, "__init__", (PyCFunction)SmartPtrInit, METH_VARARGS | METH_KEYWORDS);
@@ -0,0 +1,304 @@
+// Bindings
+#include "CPyCppyy.h"
+#include "ReflectionCache.h"
+
+// Standard
+#include <stdio.h>
+#include <string.h>
+#include <unordered_map>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+//- data _______________________________________________________________________
+namespace {
+
+using namespace CPyCppyy::ReflectionCache;
+
+// File layout, in native byte order (the fingerprint covers the platform):
+//   header:  magic (8 chars), version (u32), reserved (u32), fingerprint (u64),
+//            number of scopes (u64)
+//   scopes:  name (string), number of methods (u32), then per method: flags (u32),
+//            number of arguments (u32), name (string), return type (string)
+// where strings are stored as their length (u32) followed by the characters.
+const char     kMagic[8] = {'C', 'P', 'Y', 'C', 'R', 'F', 'L', 'C'};
+const uint32_t kVersion  = 1;
+
+struct Header_t {
+    char     fMagic[8];
+    uint32_t fVersion;
+    uint32_t fReserved;
+    uint64_t fFingerprint;
+    uint64_t fNScopes;
+};
+
+// scope record, as found in the mapped file
+struct Record_t {
+    const char* fBegin;         // first method
+    const char* fEnd;
+    uint32_t    fNMethods;
+};
+
+struct CacheState_t {
+    CacheState_t() : fFingerprint(0), fActive(false), fMap(nullptr), fMapSize(0) {}
+
+    std::string fPath;
+    uint64_t    fFingerprint;
+    bool        fActive;
+
+    const char* fMap;
+    size_t      fMapSize;
+    std::unordered_map<std::string, Record_t> fMapped;
+    std::unordered_map<std::string, std::vector<MethodInfo_t>> fNew;
+};
+
+static CacheState_t gCache;
+
+
+//- helpers --------------------------------------------------------------------
+class Reader {
+public:
+    Reader(const char* begin, const char* end) : fCur(begin), fEnd(end) {}
+
+    bool U32(uint32_t& val) {
+        if (fEnd - fCur < (ptrdiff_t)sizeof(uint32_t))
+            return false;
+        memcpy(&val, fCur, sizeof(uint32_t));
+        fCur += sizeof(uint32_t);
+        return true;
+    }
+
+    bool Str(std::string* str) {
+        uint32_t len = 0;
+        if (!U32(len) || (size_t)(fEnd - fCur) < len)
+            return false;
+        if (str) str->assign(fCur, len);
+        fCur += len;
+        return true;
+    }
+
+public:
+    const char* fCur;
+    const char* fEnd;
+};
+
+static void AppendU32(std::string& buf, uint32_t val)
+{
+    buf.append((const char*)&val, sizeof(uint32_t));
+}
+
+static void AppendStr(std::string& buf, const std::string& str)
+{
+    AppendU32(buf, (uint32_t)str.size());
+    buf.append(str);
+}
+
+static bool ReadMethods(Reader& r, uint32_t nmethods, std::vector<MethodInfo_t>* infos)
+{
+// decode (or, without infos, only validate) the methods of a scope record
+    MethodInfo_t mi;
+    for (uint32_t imeth = 0; imeth < nmethods; ++imeth) {
+        if (!r.U32(mi.fFlags) || !r.U32(mi.fNArgs) || \
+                !r.Str(infos ? &mi.fName : nullptr) || !r.Str(infos ? &mi.fReturnType : nullptr))
+            return false;
+        if (infos) infos->push_back(mi);
+    }
+    return true;
+}
+
+static uint64_t HashFingerprint(const std::string& fingerprint)
+{
+// FNV-1a, seeded with what makes the file layout platform dependent
+    uint64_t hash = 14695981039346656037ull;
+    std::string key = fingerprint + '\0' + std::to_string(kVersion) + '\0' + std::to_string(sizeof(void*));
+    for (unsigned char c : key) {
+        hash ^= c;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+static bool Index()
+{
+// verify the header and locate the scope records in the mapped file
+    Header_t h;
+    memcpy(&h, gCache.fMap, sizeof(Header_t));
+    if (memcmp(h.fMagic, kMagic, sizeof(kMagic)) != 0 || h.fVersion != kVersion || \
+            h.fFingerprint != gCache.fFingerprint)
+        return false;
+
+    Reader r(gCache.fMap + sizeof(Header_t), gCache.fMap + gCache.fMapSize);
+    for (uint64_t iscope = 0; iscope < h.fNScopes; ++iscope) {
+        std::string name;
+        uint32_t nmethods = 0;
+        if (!r.Str(&name) || !r.U32(nmethods))
+            return false;
+        const char* begin = r.fCur;
+        if (!ReadMethods(r, nmethods, nullptr))
+            return false;
+        gCache.fMapped[name] = Record_t{begin, r.fCur, nmethods};
+    }
+
+    return true;
+}
+
+static void Unmap()
+{
+#ifndef _WIN32
+    if (gCache.fMap)
+        munmap((void*)gCache.fMap, gCache.fMapSize);
+#endif
+    gCache.fMap = nullptr;
+    gCache.fMapSize = 0;
+    gCache.fMapped.clear();
+}
+
+static void Write()
+{
+// write the still valid mapped records and the new ones to a temporary file, which
+// then replaces the cache file (as processes may be writing concurrently)
+    std::string buf;
+    buf.reserve(gCache.fMapSize + 4096);
+
+    Header_t h;
+    memcpy(h.fMagic, kMagic, sizeof(kMagic));
+    h.fVersion     = kVersion;
+    h.fReserved    = 0;
+    h.fFingerprint = gCache.fFingerprint;
+    h.fNScopes     = 0;
+    buf.append((const char*)&h, sizeof(Header_t));
+
+    for (const auto& m : gCache.fMapped) {
+        if (gCache.fNew.find(m.first) != gCache.fNew.end())
+            continue;
+        AppendStr(buf, m.first);
+        AppendU32(buf, m.second.fNMethods);
+        buf.append(m.second.fBegin, m.second.fEnd - m.second.fBegin);
+        h.fNScopes += 1;
+    }
+
+    for (const auto& n : gCache.fNew) {
+        AppendStr(buf, n.first);
+        AppendU32(buf, (uint32_t)n.second.size());
+        for (const auto& mi : n.second) {
+            AppendU32(buf, mi.fFlags);
+            AppendU32(buf, mi.fNArgs);
+            AppendStr(buf, mi.fName);
+            AppendStr(buf, mi.fReturnType);
+        }
+        h.fNScopes += 1;
+    }
+    memcpy(&buf[0], &h, sizeof(Header_t));
+
+#ifndef _WIN32
+    const std::string& tmp = gCache.fPath + ".tmp" + std::to_string((long)getpid());
+#else
+    const std::string& tmp = gCache.fPath + ".tmp";
+#endif
+    FILE* f = fopen(tmp.c_str(), "wb");
+    if (!f)
+        return;
+    bool ok = fwrite(buf.data(), 1, buf.size(), f) == buf.size();
+    ok = (fclose(f) == 0) && ok;
+    if (!ok || rename(tmp.c_str(), gCache.fPath.c_str()) != 0)
+        remove(tmp.c_str());
+}
+
+static void CloseAtExit()
+{
+    CPyCppyy::ReflectionCache::Close();
+}
+
+} // unnamed namespace
+
+
+//- public functions -----------------------------------------------------------
+bool CPyCppyy::ReflectionCache::Open(const std::string& path, const std::string& fingerprint)
+{
+// start using the cache file at path; an existing file is only used if it is valid and
+// matches the fingerprint, otherwise it will be replaced on exit
+    static bool sRegistered = false;
+
+    Close();
+#ifdef _WIN32
+    (void)path; (void)fingerprint;
+    return false;
+#else
+    if (!sRegistered) {
+        Py_AtExit(CloseAtExit);
+        sRegistered = true;
+    }
+
+    gCache.fPath = path;
+    gCache.fFingerprint = HashFingerprint(fingerprint);
+    gCache.fActive = true;
+
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return true;              // no cache yet
+
+    struct stat st;
+    if (fstat(fd, &st) == 0 && (size_t)st.st_size >= sizeof(Header_t)) {
+        void* addr = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr != MAP_FAILED) {
+            gCache.fMap = (const char*)addr;
+            gCache.fMapSize = (size_t)st.st_size;
+        }
+    }
+    close(fd);
+
+    if (gCache.fMap && !Index())
+        Unmap();                  // stale or corrupt: start afresh
+
+    return true;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+void CPyCppyy::ReflectionCache::Close()
+{
+// write out new entries, if any, and stop using the cache
+    if (gCache.fActive && !gCache.fNew.empty())
+        Write();
+
+    Unmap();
+    gCache.fNew.clear();
+    gCache.fActive = false;
+}
+
+//-----------------------------------------------------------------------------
+bool CPyCppyy::ReflectionCache::IsActive()
+{
+    return gCache.fActive;
+}
+
+//-----------------------------------------------------------------------------
+bool CPyCppyy::ReflectionCache::Lookup(
+    const std::string& scope, size_t nmethods, std::vector<MethodInfo_t>& infos)
+{
+// retrieve the methods of scope, if cached and still consistent with the backend
+    if (!gCache.fActive)
+        return false;
+
+    auto m = gCache.fMapped.find(scope);
+    if (m == gCache.fMapped.end() || m->second.fNMethods != nmethods)
+        return false;
+
+    Reader r(m->second.fBegin, m->second.fEnd);
+    infos.clear();
+    infos.reserve(nmethods);
+    return ReadMethods(r, m->second.fNMethods, &infos);
+}
+
+//-----------------------------------------------------------------------------
+void CPyCppyy::ReflectionCache::Store(
+    const std::string& scope, const std::vector<MethodInfo_t>& infos)
+{
+    if (gCache.fActive)
+        gCache.fNew[scope] = infos;
+}
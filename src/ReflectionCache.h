@@ -0,0 +1,50 @@
+#ifndef CPYCPPYY_REFLECTIONCACHE_H
+#define CPYCPPYY_REFLECTIONCACHE_H
+
+// Standard
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+
+namespace CPyCppyy {
+
+/** Persistent cache of the reflection results that class proxies are built from
+
+      The method tables of classes, as queried from the backend when building a
+      proxy, are stored in a file that later processes memory map on start-up.
+      Entries are per scope name and only valid for the same method count (methods
+      are identified by their index in Cppyy::GetClassMethods()), in a file with
+      the same fingerprint of the headers and libraries loaded, as provided by the
+      caller. New entries are written out, atomically, on exit.
+ */
+
+namespace ReflectionCache {
+
+// per-method data used when building class proxies
+    struct MethodInfo_t {
+        enum EFlags {
+            kIsPublic      = 0x0001,
+            kIsConstructor = 0x0002,
+            kIsTemplated   = 0x0004,
+            kIsStatic      = 0x0008
+        };
+
+        uint32_t    fFlags;
+        uint32_t    fNArgs;
+        std::string fName;        // empty if not public
+        std::string fReturnType;  // only set for operator() and operator[]
+    };
+
+    bool Open(const std::string& path, const std::string& fingerprint);
+    void Close();
+    bool IsActive();
+
+    bool Lookup(const std::string& scope, size_t nmethods, std::vector<MethodInfo_t>& infos);
+    void Store(const std::string& scope, const std::vector<MethodInfo_t>& infos);
+
+} // namespace ReflectionCache
+
+} // namespace CPyCppyy
+
+#endif // !CPYCPPYY_REFLECTIONCACHE_H
@@ -447,27 +447,36 @@ static inline std::string targs2str(TemplateProxy* pytmpl)
     return CPyCppyy_PyText_AsString(pytmpl->fTemplateArgs);
 }
 
-static inline void UpdateDispatchMap(TemplateProxy* pytmpl, bool use_targs, uint64_t sighash, CPPOverload* pymeth)
+static inline void UpdateDispatchMap(TemplateProxy* pytmpl, bool use_targs, const Signature_t& sig, CPPOverload* pymeth)
 {
 // Memoize a method in the dispatch map after successful call; replace old if need be (may be
 // with the same CPPOverload, just with more methods).
     bool bInserted = false;
-    auto& v = pytmpl->fTI->fDispatchMap[use_targs ? targs2str(pytmpl) : ""];
+    const std::string& key = use_targs ? targs2str(pytmpl) : "";
+    std::vector<CPPOverload*> replaced;
 
     Py_INCREF(pymeth);
-    for (auto& p : v) {
-        if (p.first == sighash) {
-            Py_DECREF(p.second);
-            p.second = pymeth;
-            bInserted = true;
+    {
+        LockGuard_t lock(pytmpl->fTI->fDispatchMutex);
+        auto& v = pytmpl->fTI->fDispatchMap[key];
+        for (auto& p : v) {
+            if (p.first == sig) {
+                replaced.push_back(p.second);
+                p.second = pymeth;
+                bInserted = true;
+            }
         }
+        if (!bInserted) v.push_back(std::make_pair(sig, pymeth));
     }
-    if (!bInserted) v.push_back(std::make_pair(sighash, pymeth));
+
+// release outside the lock, as deallocation may run arbitrary code
+    for (auto ol : replaced)
+        Py_DECREF(ol);
 }
 
 static inline PyObject* SelectAndForward(TemplateProxy* pytmpl, CPPOverload* pymeth,
     CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds,
-    bool implicitOkay, bool use_targs, uint64_t sighash, std::vector<Utility::PyError_t>& errors)
+    bool implicitOkay, bool use_targs, const Signature_t& sig, std::vector<Utility::PyError_t>& errors)
 {
 // Forward a call to known overloads, if any.
     if (pymeth->HasMethods()) {
@@ -481,7 +490,7 @@ static inline PyObject* SelectAndForward(TemplateProxy* pytmpl, CPPOverload* pym
         PyObject* result = CPyCppyy_tp_call(pycall, args, nargsf, kwds);
         Py_DECREF(pycall);
         if (result) {
-            UpdateDispatchMap(pytmpl, use_targs, sighash, pymeth);
+            UpdateDispatchMap(pytmpl, use_targs, sig, pymeth);
             TPPCALL_RETURN;
         }
         Utility::FetchError(errors);
@@ -491,7 +500,7 @@ static inline PyObject* SelectAndForward(TemplateProxy* pytmpl, CPPOverload* pym
 }
 
 static inline PyObject* CallMethodImp(TemplateProxy* pytmpl, PyObject*& pymeth,
-    CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds, bool impOK, uint64_t sighash)
+    CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds, bool impOK, const Signature_t& sig)
 {
 // Actual call of a given overload: takes care of handlign of "self" and
 // dereferences the overloaded method after use.
@@ -513,7 +522,7 @@ static inline PyObject* CallMethodImp(TemplateProxy* pytmpl, PyObject*& pymeth,
 
     if (result) {
         Py_XDECREF(((CPPOverload*)pymeth)->fSelf); ((CPPOverload*)pymeth)->fSelf = nullptr;    // unbind
-        UpdateDispatchMap(pytmpl, true, sighash, (CPPOverload*)pymeth);
+        UpdateDispatchMap(pytmpl, true, sig, (CPPOverload*)pymeth);
     }
 
     Py_DECREF(pymeth); pymeth = nullptr;
@@ -563,16 +572,19 @@ static PyObject* tpp_call(TemplateProxy* pytmpl, PyObject* args, PyObject* kwds)
 
 // short-cut through memoization map
     Py_ssize_t argc = CPyCppyy_PyArgs_GET_SIZE(args, nargsf);
-    uint64_t sighash = HashSignature(args, argc);
 
     CPPOverload* ol = nullptr;
     if (!pytmpl->fTemplateArgs) {
-    // look for known signatures ...
-        auto& v = pytmpl->fTI->fDispatchMap[""];
-        for (const auto& p : v) {
-            if (p.first == sighash) {
-                ol = p.second;
-                break;
+    // look for known signatures (exact match on argument types) ...
+        {
+            LockGuard_t lock(pytmpl->fTI->fDispatchMutex);
+            auto& v = pytmpl->fTI->fDispatchMap[""];
+            for (const auto& p : v) {
+                if (MatchSignature(p.first, args, argc)) {
+                    ol = p.second;
+                    Py_INCREF(ol);    // the entry may be replaced during the call
+                    break;
+                }
             }
         }
 
@@ -585,6 +597,7 @@ static PyObject* tpp_call(TemplateProxy* pytmpl, PyObject* args, PyObject* kwds)
                 result = CPyCppyy_tp_call(pymeth, args, nargsf, kwds);
                 Py_DECREF(pymeth); pymeth = nullptr;
             }
+            Py_DECREF(ol);
             if (result)
                 return result;
         }
@@ -594,6 +607,9 @@ static PyObject* tpp_call(TemplateProxy* pytmpl, PyObject* args, PyObject* kwds)
     std::vector<Utility::PyError_t> errors;
     if (ol) Utility::FetchError(errors);
 
+// signature to memoize the overload that succeeds, if any
+    const Signature_t sig = MakeSignature(args, argc);
+
 // case 1: explicit template previously selected through subscript
     if (pytmpl->fTemplateArgs) {
     // instantiate explicitly
@@ -610,7 +626,7 @@ static PyObject* tpp_call(TemplateProxy* pytmpl, PyObject* args, PyObject* kwds)
     // attempt call if found (this may fail if there are specializations)
         if (CPPOverload_Check(pymeth)) {
         // since the template args are fully explicit, allow implicit conversion of arguments
-            result = CallMethodImp(pytmpl, pymeth, args, nargsf, kwds, true, sighash);
+            result = CallMethodImp(pytmpl, pymeth, args, nargsf, kwds, true, sig);
             if (result) {
                 Py_DECREF(pyfullname);
                 TPPCALL_RETURN;
@@ -633,7 +649,7 @@ static PyObject* tpp_call(TemplateProxy* pytmpl, PyObject* args, PyObject* kwds)
             CPyCppyy_PyText_AsString(pyfullname), args, nargsf, Utility::kNone);
         if (pymeth) {
         // attempt actual call; same as above, allow implicit conversion of arguments
-            result = CallMethodImp(pytmpl, pymeth, args, nargsf, kwds, true, sighash);
+            result = CallMethodImp(pytmpl, pymeth, args, nargsf, kwds, true, sig);
             if (result) {
                 Py_DECREF(pyfullname);
                 TPPCALL_RETURN;
@@ -652,13 +668,13 @@ static PyObject* tpp_call(TemplateProxy* pytmpl, PyObject* args, PyObject* kwds)
 
 // case 2: select known non-template overload
     result = SelectAndForward(pytmpl, pytmpl->fTI->fNonTemplated, args, nargsf, kwds,
-        true /* implicitOkay */, false /* use_targs */, sighash, errors);
+        true /* implicitOkay */, false /* use_targs */, sig, errors);
     if (result)
         return result;
 
 // case 3: select known template overload
     result = SelectAndForward(pytmpl, pytmpl->fTI->fTemplated, args, nargsf, kwds,
-        false /* implicitOkay */, true /* use_targs */, sighash, errors);
+        false /* implicitOkay */, true /* use_targs */, sig, errors);
     if (result)
         return result;
 
@@ -670,7 +686,7 @@ static PyObject* tpp_call(TemplateProxy* pytmpl, PyObject* args, PyObject* kwds)
         pymeth = pytmpl->Instantiate(pytmpl->fTI->fCppName, args, nargsf, pref, &pcnt);
         if (pymeth) {
         // attempt actual call; argument based, so do not allow implicit conversions
-            result = CallMethodImp(pytmpl, pymeth, args, nargsf, kwds, false, sighash);
+            result = CallMethodImp(pytmpl, pymeth, args, nargsf, kwds, false, sig);
             if (result) TPPCALL_RETURN;
         }
         Utility::FetchError(errors);
@@ -679,7 +695,7 @@ static PyObject* tpp_call(TemplateProxy* pytmpl, PyObject* args, PyObject* kwds)
 
 // case 5: low priority methods, such as ones that take void* arguments
     result = SelectAndForward(pytmpl, pytmpl->fTI->fLowPriority, args, nargsf, kwds,
-        false /* implicitOkay */, false /* use_targs */, sighash, errors);
+        false /* implicitOkay */, false /* use_targs */, sig, errors);
     if (result)
         return result;
 
@@ -3,6 +3,8 @@
 
 // Bindings
 #include "CPPScope.h"
+#include "DispatchCache.h"
+#include "Threading.h"
 #include "Utility.h"
 
 // Standard
@@ -21,7 +23,7 @@ class CPPOverload;
 /** Template proxy object to return functions and methods
  */
 
-typedef std::pair<uint64_t, CPPOverload*> TP_DispatchEntry_t;
+typedef std::pair<Signature_t, CPPOverload*> TP_DispatchEntry_t;
 typedef std::map<std::string, std::vector<TP_DispatchEntry_t>> TP_DispatchMap_t;
 
 class TemplateInfo {
@@ -39,6 +41,7 @@ public:
     CPPOverload* fLowPriority;    // low priority overloads such as void*/void**
 
     TP_DispatchMap_t fDispatchMap;
+    Mutex     fDispatchMutex;     // held for lookups and updates of fDispatchMap
     PyObject* fDoc;
 };
 
@@ -0,0 +1,77 @@
+#ifndef CPYCPPYY_THREADING_H
+#define CPYCPPYY_THREADING_H
+
+// Standard
+#include <mutex>
+
+
+namespace CPyCppyy {
+
+/** Locks for binding state on free-threaded python builds
+
+      With the GIL, all binding state (class proxy registry, converter and executor
+      factories, dispatch caches, object tracking) is protected by the interpreter,
+      and the locks below are no-ops that compile away. On builds without the GIL
+      (Py_GIL_DISABLED), two kinds are used:
+
+      Mutex:          short, non-recursive critical sections on hot data (dispatch
+                      caches, the class registry, tracked objects); never held while
+                      calling out into python or C++. Based on PyMutex, which detaches
+                      the thread while waiting, so it can not block a stop-the-world.
+
+      RecursiveMutex: the bindings lock, for the slow paths that build converters,
+                      executors and callback wrappers, which may recurse and call out
+                      into python and the backend; the thread is detached if it needs
+                      to wait for the lock.
+
+      Fine-grained locks are always taken inside the bindings lock, never around it.
+ */
+
+#ifdef Py_GIL_DISABLED
+#define CPYCPPYY_FREE_THREADED 1
+
+class Mutex {
+public:
+    void lock()   { PyMutex_Lock(&fMutex); }
+    void unlock() { PyMutex_Unlock(&fMutex); }
+
+private:
+    PyMutex fMutex = {0};
+};
+
+class RecursiveMutex {
+public:
+    void lock() {
+        if (fMutex.try_lock())
+            return;
+        Py_BEGIN_ALLOW_THREADS
+        fMutex.lock();
+        Py_END_ALLOW_THREADS
+    }
+    void unlock() { fMutex.unlock(); }
+
+private:
+    std::recursive_mutex fMutex;
+};
+
+#else
+
+class Mutex {
+public:
+    void lock()   {}
+    void unlock() {}
+};
+
+typedef Mutex RecursiveMutex;
+
+#endif // Py_GIL_DISABLED
+
+typedef std::lock_guard<Mutex> LockGuard_t;
+typedef std::lock_guard<RecursiveMutex> BindingsLockGuard_t;
+
+// lock for the slow paths of the bindings (see above)
+extern RecursiveMutex gBindingsLock;
+
+} // namespace CPyCppyy
+
+#endif // !CPYCPPYY_THREADING_H
@@ -1,8 +1,12 @@
 // Bindings
 #include "CPyCppyy.h"
 #include "TupleOfInstances.h"
+#include "CPPInstance.h"
 #include "ProxyWrappers.h"
 
+// Standard
+#include <new>
+
 
 namespace {
 
@@ -81,6 +85,90 @@ static PyMappingMethods ia_as_mapping = {
     (objobjargproc)nullptr,        // mp_ass_subscript
 };
 
+
+//= lightweight view on a C-style array of instances =========================
+typedef struct {
+    PyObject_HEAD
+    CPyCppyy::PyClassRef     iv_klass;
+    char*                    iv_start;
+    Py_ssize_t               iv_len;
+    Py_ssize_t               iv_stride;
+    PyObject*                iv_owner;
+} iv_viewobject;
+
+static void iv_dealloc(iv_viewobject* iv)
+{
+    PyObject_GC_UnTrack(iv);
+    Py_XDECREF(iv->iv_owner);
+    iv->iv_klass.~PyClassRef();
+    PyObject_GC_Del(iv);
+}
+
+static int iv_traverse(iv_viewobject* iv, visitproc visit, void* arg)
+{
+    Py_VISIT(iv->iv_owner);
+    return 0;
+}
+
+static Py_ssize_t iv_length(iv_viewobject* iv)
+{
+    return iv->iv_len;
+}
+
+static PyObject* iv_item(iv_viewobject* iv, Py_ssize_t idx)
+{
+    if (idx < 0 || iv->iv_len <= idx) {
+        PyErr_SetString(PyExc_IndexError, "index out of range");
+        return nullptr;
+    }
+
+// no lookup in, nor registration with, the memory regulator
+    return CPyCppyy::BindCppObjectNoCast(iv->iv_start + idx*iv->iv_stride,
+        iv->iv_klass, CPyCppyy::CPPInstance::kNoMemReg);
+}
+
+static PyObject* iv_subscript(iv_viewobject* iv, PyObject* pyidx)
+{
+    if (PySlice_Check(pyidx)) {
+        Py_ssize_t start, stop, step;
+        if (PySlice_Unpack(pyidx, &start, &stop, &step) < 0)
+            return nullptr;
+        Py_ssize_t len = PySlice_AdjustIndices(iv->iv_len, &start, &stop, step);
+
+    // a slice is a view on the same array, keeping the same owner alive
+        PyObject* view = CPyCppyy::InstanceArrayView_New(iv->iv_start + start*iv->iv_stride,
+            iv->iv_klass.GetScope(), len, iv->iv_owner);
+        if (view)
+            ((iv_viewobject*)view)->iv_stride = iv->iv_stride*step;
+        return view;
+    }
+
+    Py_ssize_t idx = PyNumber_AsSsize_t(pyidx, PyExc_IndexError);
+    if (idx == (Py_ssize_t)-1 && PyErr_Occurred())
+        return nullptr;
+    if (idx < 0) idx += iv->iv_len;
+    return iv_item(iv, idx);
+}
+
+static PySequenceMethods iv_as_sequence = {
+    (lenfunc)iv_length,            // sq_length
+    0,                             // sq_concat
+    0,                             // sq_repeat
+    (ssizeargfunc)iv_item,         // sq_item
+    0,                             // sq_slice
+    0,                             // sq_ass_item
+    0,                             // sq_ass_slice
+    0,                             // sq_contains
+    0,                             // sq_inplace_concat
+    0,                             // sq_inplace_repeat
+};
+
+static PyMappingMethods iv_as_mapping = {
+    (lenfunc)      iv_length,      // mp_length
+    (binaryfunc)   iv_subscript,   // mp_subscript
+    (objobjargproc)nullptr,        // mp_ass_subscript
+};
+
 } // unnamed namespace
 
 
@@ -185,6 +273,90 @@ PyObject* TupleOfInstances_New(
     return nullptr;
 }
 
+//= view on C-style arrays of objects ========================================
+PyObject* InstanceArrayView_New(Cppyy::TCppObject_t address,
+    Cppyy::TCppScope_t klass, Py_ssize_t size, PyObject* owner)
+{
+    Py_ssize_t stride = (Py_ssize_t)Cppyy::SizeOf(klass);
+    if (stride == 0) {
+        PyErr_Format(PyExc_TypeError,
+            "can not determine size of type \"%s\" for array indexing",
+            Cppyy::GetScopedFinalName(klass).c_str());
+        return nullptr;
+    }
+
+    iv_viewobject* iv = PyObject_GC_New(iv_viewobject, &InstanceArrayView_Type);
+    if (!iv) return nullptr;
+
+    new (&iv->iv_klass) PyClassRef(klass);
+    iv->iv_start  = (char*)address;
+    iv->iv_len    = size < 0 ? 0 : size;
+    iv->iv_stride = stride;
+    Py_XINCREF(owner);
+    iv->iv_owner  = owner;
+
+    PyObject_GC_Track(iv);
+    return (PyObject*)iv;
+}
+
+PyTypeObject InstanceArrayView_Type = {
+    PyVarObject_HEAD_INIT(&PyType_Type, 0)
+    (char*)"cppyy.InstanceArrayView", // tp_name
+    sizeof(iv_viewobject),         // tp_basicsize
+    0,                             // tp_itemsize
+    (destructor)iv_dealloc,        // tp_dealloc
+    0,                             // tp_vectorcall_offset / tp_print
+    0,                             // tp_getattr
+    0,                             // tp_setattr
+    0,                             // tp_as_async / tp_compare
+    0,                             // tp_repr
+    0,                             // tp_as_number
+    &iv_as_sequence,               // tp_as_sequence
+    &iv_as_mapping,                // tp_as_mapping
+    0,                             // tp_hash
+    0,                             // tp_call
+    0,                             // tp_str
+    0,                             // tp_getattro
+    0,                             // tp_setattro
+    0,                             // tp_as_buffer
+    Py_TPFLAGS_DEFAULT |
+        Py_TPFLAGS_HAVE_GC,        // tp_flags
+    (char*)"view on a C-style array of C++ instances, without identity tracking", // tp_doc
+    (traverseproc)iv_traverse,     // tp_traverse
+    0,                             // tp_clear
+    0,                             // tp_richcompare
+    0,                             // tp_weaklistoffset
+    0,                             // tp_iter
+    0,                             // tp_iternext
+    0,                             // tp_methods
+    0,                             // tp_members
+    0,                             // tp_getset
+    0,                             // tp_base
+    0,                             // tp_dict
+    0,                             // tp_descr_get
+    0,                             // tp_descr_set
+    0,                             // tp_dictoffset
+    0,                             // tp_init
+    0,                             // tp_alloc
+    0,                             // tp_new
+    0,                             // tp_free
+    0,                             // tp_is_gc
+    0,                             // tp_bases
+    0,                             // tp_mro
+    0,                             // tp_cache
+    0,                             // tp_subclasses
+    0                              // tp_weaklist
+#if PY_VERSION_HEX >= 0x02030000
+    , 0                            // tp_del
+#endif
+#if PY_VERSION_HEX >= 0x02060000
+    , 0                            // tp_version_tag
+#endif
+#if PY_VERSION_HEX >= 0x03040000
+    , 0                            // tp_finalize
+#endif
+};
+
 //= CPyCppyy custom tuple-like array type ====================================
 PyTypeObject TupleOfInstances_Type = {
     PyVarObject_HEAD_INIT(&PyType_Type, 0)
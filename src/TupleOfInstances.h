@@ -32,6 +32,22 @@ inline bool TupleOfInstances_CheckExact(T* object)
 PyObject* TupleOfInstances_New(
     Cppyy::TCppObject_t address, Cppyy::TCppScope_t klass, cdims_t dims);
 
+//- lightweight sequence view over a C-style array of instances --------------
+// Elements are bound on access, as pointers into the array, without identity tracking
+// (see CPPInstance::kNoMemReg), so that bulk extraction does not pay for maintaining
+// the memory regulator; owner (may be nullptr) is kept alive by the view, but not by
+// the element proxies, which should thus not outlive the view.
+extern PyTypeObject InstanceArrayView_Type;
+
+template<typename T>
+inline bool InstanceArrayView_Check(T* object)
+{
+    return object && PyObject_TypeCheck(object, &InstanceArrayView_Type);
+}
+
+PyObject* InstanceArrayView_New(Cppyy::TCppObject_t address,
+    Cppyy::TCppScope_t klass, Py_ssize_t size, PyObject* owner = nullptr);
+
 } // namespace CPyCppyy
 
 #endif // !CPYCPPYY_TUPLEOFINSTANCES_H
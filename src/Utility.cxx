@@ -9,6 +9,7 @@
 #include "PyStrings.h"
 #include "CustomPyTypes.h"
 #include "TemplateProxy.h"
+#include "Threading.h"
 #include "TypeManip.h"
 
 // Standard
@@ -847,24 +848,23 @@ static inline bool check_scope(const std::string& name)
 void CPyCppyy::Utility::ConstructCallbackPreamble(const std::string& retType,
     const std::vector<std::string>& argtypes, std::ostringstream& code)
 {
-// Generate function setup to be used in callbacks (wrappers and overrides).
+// Generate function setup to be used in callbacks (wrappers and overrides). The
+// converters are created once, arguments go into a stack array, with the first slot
+// left free for use with PY_VECTORCALL_ARGUMENTS_OFFSET, and the GIL is only acquired
+// if the calling thread does not hold it already.
     int nArgs = (int)argtypes.size();
 
 // return value and argument type converters
     bool isVoid = retType == "void";
     if (!isVoid)
-        code << "    CPYCPPYY_STATIC std::unique_ptr<CPyCppyy::Converter, std::function<void(CPyCppyy::Converter*)>> "
+        code << "    CPYCPPYY_STATIC std::unique_ptr<CPyCppyy::Converter, void(*)(CPyCppyy::Converter*)> "
                      "retconv{CPyCppyy::CreateConverter(\""
              << retType << "\"), CPyCppyy::DestroyConverter};\n";
-    std::vector<bool> arg_is_ptr;
+    std::vector<bool> arg_is_ptr(nArgs, false);
     if (nArgs) {
-        arg_is_ptr.reserve(nArgs);
-        code << "    CPYCPPYY_STATIC std::vector<std::unique_ptr<CPyCppyy::Converter, std::function<void(CPyCppyy::Converter*)>>> argcvs;\n"
-             << "    if (argcvs.empty()) {\n"
-             << "      argcvs.reserve(" << nArgs << ");\n";
+        code << "    CPYCPPYY_STATIC std::unique_ptr<CPyCppyy::Converter, void(*)(CPyCppyy::Converter*)> argcvs[] = {\n";
         for (int i = 0; i < nArgs; ++i) {
-            arg_is_ptr[i] = false;
-            code << "      argcvs.emplace_back(CPyCppyy::CreateConverter(\"";
+            code << "      {CPyCppyy::CreateConverter(\"";
             const std::string& at = argtypes[i];
             const std::string& res_at = Cppyy::ResolveName(at);
             const std::string& cpd = TypeManip::compound(res_at);
@@ -880,33 +880,28 @@ void CPyCppyy::Utility::ConstructCallbackPreamble(const std::string& retType,
                 } else code << at;
             } else
                  code << at;
-            code << "\"), CPyCppyy::DestroyConverter);\n";
+            code << "\"), CPyCppyy::DestroyConverter}" << (i != nArgs-1 ? ",\n" : "};\n");
         }
-        code << "    }\n";
     }
 
 // declare return value (TODO: this does not work for most non-builtin values)
     if (!isVoid)
         code << "    " << retType << " ret{};\n";
 
-// acquire GIL
-    code << "    PyGILState_STATE state = PyGILState_Ensure();\n";
-
-// build argument tuple if needed
-    if (nArgs) {
-        code << "    std::vector<PyObject*> pyargs;\n";
-        code << "    pyargs.reserve(" << nArgs << ");\n"
-             << "    try {\n";
-        for (int i = 0; i < nArgs; ++i) {
-            code << "      pyargs.emplace_back(argcvs[" << i << "]->FromMemory((void*)";
-            if (!arg_is_ptr[i]) code << '&';
-            code << "arg" << i << "));\n"
-                 << "      if (!pyargs.back()) throw " << i << ";\n";
-        }
-        code << "    } catch(int) {\n"
-             << "      for (auto pyarg : pyargs) Py_XDECREF(pyarg);\n"
-             << "      CPyCppyy::PyException pyexc; PyGILState_Release(state); throw pyexc;\n"
-             << "    }\n";
+// acquire GIL, unless already held
+    code << "    const bool gilHeld = PyGILState_Check();\n"
+            "    PyGILState_STATE state = gilHeld ? PyGILState_LOCKED : PyGILState_Ensure();\n";
+
+// convert the arguments
+    code << "    PyObject* pyargs[" << nArgs+1 << "];\n";
+    for (int i = 0; i < nArgs; ++i) {
+        code << "    pyargs[" << i+1 << "] = argcvs[" << i << "]->FromMemory((void*)";
+        if (!arg_is_ptr[i]) code << '&';
+        code << "arg" << i << ");\n"
+             << "    if (!pyargs[" << i+1 << "]) {\n";
+        if (i) code << "      for (int i = 1; i < " << i+1 << "; ++i) Py_DECREF(pyargs[i]);\n";
+        code << "      CPyCppyy::PyException pyexc; if (!gilHeld) PyGILState_Release(state); throw pyexc;\n"
+                "    }\n";
     }
 }
 
@@ -917,7 +912,7 @@ void CPyCppyy::Utility::ConstructCallbackReturn(const std::string& retType, int
     bool isPtr  = Cppyy::ResolveName(retType).back() == '*';
 
     if (nArgs)
-        code << "    for (auto pyarg : pyargs) Py_DECREF(pyarg);\n";
+        code << "    for (int i = 1; i < " << nArgs+1 << "; ++i) Py_DECREF(pyargs[i]);\n";
     code << "    bool cOk = (bool)pyresult;\n"
             "    if (pyresult) {\n";
     if (isPtr) {
@@ -936,9 +931,9 @@ void CPyCppyy::Utility::ConstructCallbackReturn(const std::string& retType, int
 #ifdef _WIN32
             " /* do nothing */ }\n"
 #else
-            " CPyCppyy::PyException pyexc; PyGILState_Release(state); throw pyexc; }\n"
+            " CPyCppyy::PyException pyexc; if (!gilHeld) PyGILState_Release(state); throw pyexc; }\n"
 #endif
-            "    PyGILState_Release(state);\n"
+            "    if (!gilHeld) PyGILState_Release(state);\n"
             "    return";
     code << (isVoid ? ";\n  }\n" : " ret;\n  }\n");
 }
@@ -951,6 +946,7 @@ PyObject* CPyCppyy::Utility::FuncPtr2StdFunction(
         const std::string& retType, const std::string& signature, void* address)
 {
 // Convert a function pointer to an equivalent std::function<> object.
+    BindingsLockGuard_t lock(gBindingsLock);
     static int maker_count = 0;
 
     auto pf = sStdFuncLookup.find(address);
@@ -0,0 +1,559 @@
+// Bindings
+#include "CPyCppyy.h"
+#include "VectorCall.h"
+#include "CPPFunction.h"
+#include "CPPInstance.h"
+#include "CPPOverload.h"
+#include "CallContext.h"
+#include "TypeManip.h"
+
+// Standard
+#include <limits.h>
+#include <string.h>
+#include <exception>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+//- data and local helpers ---------------------------------------------------
+namespace {
+
+using namespace CPyCppyy;
+
+// builtin scalar types that vectorized calls support, for arguments and results
+enum EScalar {
+    kNotScalar = -1,
+    kSBool = 0, kSInt8, kSUInt8, kSShort, kSUShort, kSInt, kSUInt,
+    kSLong, kSULong, kSLLong, kSULLong, kSFloat, kSDouble,
+    kNScalars
+};
+
+struct ScalarInfo_t {
+    size_t fSize;
+    char   fTypeCode;       // as set in Parameter by the matching converter
+    char   fArrayCode;      // type code in python's array module, for results
+    bool   fIsInteger;
+    bool   fIsSigned;
+};
+
+static const ScalarInfo_t gScalarInfo[kNScalars] = {
+    {sizeof(bool),               'l', 'B', true,  false},
+    {sizeof(int8_t),             'l', 'b', true,  true },
+    {sizeof(uint8_t),            'l', 'B', true,  false},
+    {sizeof(short),              'l', 'h', true,  true },
+    {sizeof(unsigned short),     'l', 'H', true,  false},
+    {sizeof(int),                'l', 'i', true,  true },
+    {sizeof(unsigned int),       'L', 'I', true,  false},
+    {sizeof(long),               'l', 'l', true,  true },
+    {sizeof(unsigned long),      'L', 'L', true,  false},
+    {sizeof(long long),          'q', 'q', true,  true },
+    {sizeof(unsigned long long), 'Q', 'Q', true,  false},
+    {sizeof(float),              'f', 'f', false, true },
+    {sizeof(double),             'd', 'd', false, true }
+};
+
+union ScalarValue_t {
+    bool               fBool;
+    long long          fLLong;
+    unsigned long long fULLong;
+    double             fDouble;
+};
+
+//----------------------------------------------------------------------------
+static EScalar ScalarFromCppType(const std::string& cppname)
+{
+// only by-value builtins qualify (references would need the value to be kept)
+    static const std::unordered_map<std::string, EScalar> sScalars = {
+        {"bool",               kSBool},
+        {"signed char",        kSInt8},   {"int8_t",  kSInt8},  {"std::int8_t",  kSInt8},
+        {"unsigned char",      kSUInt8},  {"uint8_t", kSUInt8}, {"std::uint8_t", kSUInt8},
+        {"short",              kSShort},
+        {"unsigned short",     kSUShort},
+        {"int",                kSInt},
+        {"unsigned int",       kSUInt},
+        {"long",               kSLong},
+        {"unsigned long",      kSULong},
+        {"long long",          kSLLong},
+        {"unsigned long long", kSULLong},
+        {"float",              kSFloat},
+        {"double",             kSDouble}
+    };
+
+    const std::string& name = TypeManip::remove_const(cppname);
+    auto s = sScalars.find(name);
+    if (s == sScalars.end())
+        s = sScalars.find(Cppyy::ResolveName(name));
+    return s != sScalars.end() ? s->second : kNotScalar;
+}
+
+static EScalar IntegerOfSize(Py_ssize_t size, bool isSigned)
+{
+    for (int k = kSInt8; k <= kSULLong; ++k) {
+        if (gScalarInfo[k].fIsSigned == isSigned && (Py_ssize_t)gScalarInfo[k].fSize == size)
+            return (EScalar)k;
+    }
+    return kNotScalar;
+}
+
+static EScalar ScalarFromFormat(const char* fmt, Py_ssize_t itemsize)
+{
+// element type of a buffer; only single, native byte order, elements are accepted
+    if (!fmt) fmt = "B";              // per the buffer protocol
+    if (*fmt == '@' || *fmt == '=')
+        fmt += 1;
+#if PY_LITTLE_ENDIAN
+    else if (*fmt == '<')
+        fmt += 1;
+#else
+    else if (*fmt == '>' || *fmt == '!')
+        fmt += 1;
+#endif
+    if (!fmt[0] || fmt[1])
+        return kNotScalar;
+
+    switch (fmt[0]) {
+    case '?':
+        return itemsize == (Py_ssize_t)sizeof(bool) ? kSBool : kNotScalar;
+    case 'b': case 'h': case 'i': case 'l': case 'q': case 'n':
+        return IntegerOfSize(itemsize, true);
+    case 'B': case 'H': case 'I': case 'L': case 'Q': case 'N':
+        return IntegerOfSize(itemsize, false);
+    case 'f':
+        return itemsize == (Py_ssize_t)sizeof(float) ? kSFloat : kNotScalar;
+    case 'd':
+        return itemsize == (Py_ssize_t)sizeof(double) ? kSDouble : kNotScalar;
+    }
+    return kNotScalar;
+}
+
+static bool IsConvertible(EScalar from, EScalar to)
+{
+// conversions as allowed by the scalar converters, minus those that need range checks
+// on the values: integers only widen, floating point never goes to integer or bool
+    if (from == to || from == kSBool)
+        return true;
+    if (to == kSBool)
+        return false;
+
+    const ScalarInfo_t& f = gScalarInfo[from];
+    const ScalarInfo_t& t = gScalarInfo[to];
+    if (!t.fIsInteger)
+        return true;
+    if (!f.fIsInteger)
+        return false;
+    if (f.fIsSigned == t.fIsSigned)
+        return f.fSize <= t.fSize;
+    return !f.fIsSigned && f.fSize < t.fSize;
+}
+
+//----------------------------------------------------------------------------
+typedef void (*cast_t)(const char* src, void* dst);
+
+template<typename F, typename T>
+static void CastScalar(const char* src, void* dst)
+{
+    *(T*)dst = (T)*(const F*)src;
+}
+
+#define CPPYY_SCALAR_CASTS(F)                                                \
+    {CastScalar<F, bool>, CastScalar<F, int8_t>, CastScalar<F, uint8_t>,     \
+     CastScalar<F, short>, CastScalar<F, unsigned short>,                    \
+     CastScalar<F, int>, CastScalar<F, unsigned int>,                        \
+     CastScalar<F, long>, CastScalar<F, unsigned long>,                      \
+     CastScalar<F, long long>, CastScalar<F, unsigned long long>,            \
+     CastScalar<F, float>, CastScalar<F, double>}
+
+static const cast_t gCasts[kNScalars][kNScalars] = {
+    CPPYY_SCALAR_CASTS(bool),
+    CPPYY_SCALAR_CASTS(int8_t),
+    CPPYY_SCALAR_CASTS(uint8_t),
+    CPPYY_SCALAR_CASTS(short),
+    CPPYY_SCALAR_CASTS(unsigned short),
+    CPPYY_SCALAR_CASTS(int),
+    CPPYY_SCALAR_CASTS(unsigned int),
+    CPPYY_SCALAR_CASTS(long),
+    CPPYY_SCALAR_CASTS(unsigned long),
+    CPPYY_SCALAR_CASTS(long long),
+    CPPYY_SCALAR_CASTS(unsigned long long),
+    CPPYY_SCALAR_CASTS(float),
+    CPPYY_SCALAR_CASTS(double)
+};
+
+//----------------------------------------------------------------------------
+typedef void (*vcall_t)(Cppyy::TCppMethod_t, Cppyy::TCppObject_t, size_t, Parameter*, void*);
+
+static void VectorCallVoid(Cppyy::TCppMethod_t method,
+    Cppyy::TCppObject_t self, size_t nargs, Parameter* args, void*)
+{
+    Cppyy::CallV(method, self, nargs, args);
+}
+
+// the backend calls are the same as used by the corresponding executors
+#define CPPYY_IMPL_VECTOR_CALL(name, type, tcode)                            \
+static void VectorCall##name(Cppyy::TCppMethod_t method,                     \
+    Cppyy::TCppObject_t self, size_t nargs, Parameter* args, void* result)   \
+{                                                                            \
+    *(type*)result = (type)Cppyy::Call##tcode(method, self, nargs, args);    \
+}
+
+CPPYY_IMPL_VECTOR_CALL(Bool,   bool,               B)
+CPPYY_IMPL_VECTOR_CALL(Int8,   int8_t,             C)
+CPPYY_IMPL_VECTOR_CALL(UInt8,  uint8_t,            B)
+CPPYY_IMPL_VECTOR_CALL(Short,  short,              H)
+CPPYY_IMPL_VECTOR_CALL(UShort, unsigned short,     I)
+CPPYY_IMPL_VECTOR_CALL(Int,    int,                I)
+CPPYY_IMPL_VECTOR_CALL(UInt,   unsigned int,       LL)
+CPPYY_IMPL_VECTOR_CALL(Long,   long,               L)
+CPPYY_IMPL_VECTOR_CALL(ULong,  unsigned long,      LL)
+CPPYY_IMPL_VECTOR_CALL(LLong,  long long,          LL)
+CPPYY_IMPL_VECTOR_CALL(ULLong, unsigned long long, LL)
+CPPYY_IMPL_VECTOR_CALL(Float,  float,              F)
+CPPYY_IMPL_VECTOR_CALL(Double, double,             D)
+
+static const vcall_t gCalls[kNScalars] = {
+    VectorCallBool, VectorCallInt8, VectorCallUInt8, VectorCallShort, VectorCallUShort,
+    VectorCallInt, VectorCallUInt, VectorCallLong, VectorCallULong, VectorCallLLong,
+    VectorCallULLong, VectorCallFloat, VectorCallDouble
+};
+
+//----------------------------------------------------------------------------
+struct VectorArg_t {
+    EScalar       fKind;
+    const char*   fData;
+    Py_ssize_t    fStride;      // 0 for python scalars, which are broadcast
+    ScalarValue_t fScalar;
+};
+
+struct BufferViews_t {
+    BufferViews_t(size_t sz) { fViews.reserve(sz); }
+    ~BufferViews_t() { for (auto& view : fViews) PyBuffer_Release(&view); }
+    Py_buffer* Get(PyObject* pyobj, int flags) {
+        fViews.emplace_back();
+        if (PyObject_GetBuffer(pyobj, &fViews.back(), flags) < 0) {
+            fViews.pop_back();
+            return nullptr;
+        }
+        return &fViews.back();
+    }
+    std::vector<Py_buffer> fViews;
+};
+
+static bool IsConvertible(const VectorArg_t& va, EScalar to)
+{
+// python ints convert to any type that can hold their value
+    if (va.fStride || (va.fKind != kSLLong && va.fKind != kSULLong))
+        return IsConvertible(va.fKind, to);
+
+    if (to == kSBool)
+        return false;
+    if (!gScalarInfo[to].fIsInteger)
+        return true;
+    if (va.fKind == kSLLong && va.fScalar.fLLong < 0 && !gScalarInfo[to].fIsSigned)
+        return false;
+// values beyond the range of long long would otherwise round-trip through the sign bit
+    if (va.fKind == kSULLong && gScalarInfo[to].fIsSigned && LLONG_MAX < va.fScalar.fULLong)
+        return false;
+
+    ScalarValue_t value, back;
+    gCasts[va.fKind][to]((const char*)&va.fScalar, &value);
+    gCasts[to][va.fKind]((const char*)&value, &back);
+    return back.fULLong == va.fScalar.fULLong;
+}
+
+static PyObject* NewResultArray(EScalar kind, Py_ssize_t size)
+{
+// results go into an array.array, which is dependency-free and exposes a buffer
+    static PyObject* sArrayType = nullptr;
+    if (!sArrayType) {
+        PyObject* mod = PyImport_ImportModule((char*)"array");
+        if (!mod)
+            return nullptr;
+        sArrayType = PyObject_GetAttrString(mod, (char*)"array");
+        Py_DECREF(mod);
+        if (!sArrayType)
+            return nullptr;
+    }
+
+    char tc[2] = {gScalarInfo[kind].fArrayCode, '\0'};
+    PyObject* single = PyObject_CallFunction(sArrayType, (char*)"s[i]", tc, 0);
+    if (!single)
+        return nullptr;
+    PyObject* result = PySequence_Repeat(single, size);
+    Py_DECREF(single);
+    return result;
+}
+
+} // unnamed namespace
+
+
+//- public functions ---------------------------------------------------------
+PyObject* CPyCppyy::VectorizedCall(CPPOverload* pymeth, PyObject* args, PyObject* kwds)
+{
+// options: output buffer and GIL release (default as set on the overload)
+    PyObject* pyout = nullptr;
+    bool releaseGIL = pymeth->fMethodInfo->fFlags & CallContext::kReleaseGIL;
+    if (kwds) {
+        PyObject* key = nullptr, *value = nullptr;
+        Py_ssize_t pos = 0;
+        while (PyDict_Next(kwds, &pos, &key, &value)) {
+            const char* kw = CPyCppyy_PyText_AsString(key);
+            if (!kw)
+                return nullptr;
+            if (strcmp(kw, "out") == 0)
+                pyout = value != Py_None ? value : nullptr;
+            else if (strcmp(kw, "release_gil") == 0) {
+                int istrue = PyObject_IsTrue(value);
+                if (istrue == -1)
+                    return nullptr;
+                releaseGIL = (bool)istrue;
+            } else {
+                PyErr_Format(PyExc_TypeError,
+                    "__vectorize__() got an unexpected keyword argument \'%s\'", kw);
+                return nullptr;
+            }
+        }
+    }
+
+// collect element types and data of the arguments
+    const Py_ssize_t nargs = PyTuple_GET_SIZE(args);
+    BufferViews_t views(nargs+1);
+    std::vector<VectorArg_t> vargs(nargs);
+    Py_ssize_t nelem = -1;
+    for (Py_ssize_t iarg = 0; iarg < nargs; ++iarg) {
+        PyObject* pyarg = PyTuple_GET_ITEM(args, iarg);
+        VectorArg_t& va = vargs[iarg];
+        va.fStride = 0;
+        if (PyObject_CheckBuffer(pyarg)) {
+            Py_buffer* view = views.Get(pyarg, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT);
+            if (!view)
+                return nullptr;
+            va.fKind = ScalarFromFormat(view->format, view->itemsize);
+            if (va.fKind == kNotScalar) {
+                PyErr_Format(PyExc_TypeError, "argument %d: unsupported element type \'%s\'",
+                    (int)iarg+1, view->format ? view->format : "B");
+                return nullptr;
+            }
+            Py_ssize_t n = view->len / view->itemsize;
+            if (nelem != -1 && n != nelem) {
+                PyErr_Format(PyExc_ValueError,
+                    "argument %d: size %zd does not match size %zd of preceding arguments",
+                    (int)iarg+1, n, nelem);
+                return nullptr;
+            }
+            nelem = n;
+            va.fData = (const char*)view->buf;
+            va.fStride = view->itemsize;
+        } else if (PyBool_Check(pyarg)) {
+            va.fKind = kSBool;
+            va.fScalar.fBool = pyarg == Py_True;
+        } else if (PyLong_Check(pyarg)) {
+            va.fKind = kSLLong;
+            va.fScalar.fLLong = PyLong_AsLongLong(pyarg);
+            if (va.fScalar.fLLong == (long long)-1 && PyErr_Occurred()) {
+                if (!PyErr_ExceptionMatches(PyExc_OverflowError))
+                    return nullptr;
+                PyErr_Clear();
+                va.fKind = kSULLong;
+                va.fScalar.fULLong = PyLong_AsUnsignedLongLong(pyarg);
+                if (va.fScalar.fULLong == (unsigned long long)-1 && PyErr_Occurred())
+                    return nullptr;
+            }
+        } else if (PyFloat_Check(pyarg)) {
+            va.fKind = kSDouble;
+            va.fScalar.fDouble = PyFloat_AS_DOUBLE(pyarg);
+        } else {
+            PyErr_Format(PyExc_TypeError,
+                "argument %d: expected a buffer or a python scalar, got %s",
+                (int)iarg+1, Py_TYPE(pyarg)->tp_name);
+            return nullptr;
+        }
+
+        if (!va.fStride)
+            va.fData = (const char*)&va.fScalar;
+    }
+
+    if (nelem == -1) {
+        PyErr_SetString(PyExc_TypeError, "__vectorize__() requires at least one buffer argument");
+        return nullptr;
+    }
+
+// resolve the overload once, on the element types: exact matches of the buffer types
+// first, then any overload that the elements convert to
+    CPPMethod* meth = nullptr;
+    std::vector<EScalar> kinds(nargs);
+    EScalar rkind = kNotScalar;
+    for (int stage = 0; stage < 2 && !meth; ++stage) {
+        for (auto pc : pymeth->fMethodInfo->fMethods) {
+            CPPMethod* m = dynamic_cast<CPPMethod*>(pc);
+            if (!m || dynamic_cast<CPPReverseBinary*>(pc))
+                continue;
+
+            Cppyy::TCppMethod_t cppmeth = m->GetMethod();
+            if (!cppmeth || Cppyy::IsConstructor(cppmeth) || \
+                    (Py_ssize_t)Cppyy::GetMethodNumArgs(cppmeth) != nargs)
+                continue;
+
+            bool isStatic = Cppyy::IsStaticMethod(cppmeth) || Cppyy::IsNamespace(m->GetScope());
+            if (!isStatic && !pymeth->fSelf)
+                continue;
+
+            const std::string& rtype = Cppyy::GetMethodReturnTypeAsString(cppmeth);
+            rkind = rtype == "void" ? kNotScalar : ScalarFromCppType(rtype);
+            if (rkind == kNotScalar && rtype != "void")
+                continue;
+
+            bool ok = true;
+            for (Py_ssize_t iarg = 0; iarg < nargs && ok; ++iarg) {
+                kinds[iarg] = ScalarFromCppType(Cppyy::GetMethodArgTypeAsString(cppmeth, iarg));
+                const VectorArg_t& va = vargs[iarg];
+                ok = kinds[iarg] != kNotScalar && \
+                    ((stage == 0 && va.fStride) ? va.fKind == kinds[iarg] : IsConvertible(va, kinds[iarg]));
+            }
+
+            if (ok) {
+                meth = m;
+                break;
+            }
+        }
+    }
+
+    if (!meth) {
+        PyErr_Format(PyExc_TypeError,
+            "no overload of %s() takes and returns builtin scalars matching the given arguments",
+            pymeth->GetName().c_str());
+        return nullptr;
+    }
+
+// the object to call on, if any, as for regular calls
+    Cppyy::TCppObject_t cppself = nullptr;
+    if (!(Cppyy::IsStaticMethod(meth->GetMethod()) || Cppyy::IsNamespace(meth->GetScope()))) {
+        void* object = pymeth->fSelf->GetObject();
+        if (!object) {
+            PyErr_SetString(PyExc_ReferenceError, "attempt to access a null-pointer");
+            return nullptr;
+        }
+
+        Cppyy::TCppType_t derived = pymeth->fSelf->ObjectIsA();
+        ptrdiff_t offset = 0;
+        if (derived && derived != meth->GetScope())
+            offset = Cppyy::GetBaseOffset(derived, meth->GetScope(), object, 1 /* up-cast */);
+        cppself = (Cppyy::TCppObject_t)((intptr_t)object + offset);
+    }
+
+// setup the output buffer, allocating a new one if none given
+    PyObject* result = nullptr;
+    char* out = nullptr;
+    Py_ssize_t ostride = 0;
+    cast_t ostore = nullptr;
+    if (rkind != kNotScalar) {
+        EScalar okind = rkind == kSBool ? kSUInt8 : rkind;
+        if (pyout) {
+            Py_INCREF(pyout);
+            result = pyout;
+        } else if (!(result = NewResultArray(okind, nelem)))
+            return nullptr;
+
+        Py_buffer* view = views.Get(result, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT | PyBUF_WRITABLE);
+        if (!view) {
+            Py_DECREF(result);
+            return nullptr;
+        }
+
+        if (pyout) {
+            okind = ScalarFromFormat(view->format, view->itemsize);
+            if (okind == kNotScalar || !IsConvertible(rkind, okind) || view->len / view->itemsize != nelem) {
+                PyErr_Format(PyExc_TypeError,
+                    "output buffer does not hold %zd elements that %s converts to",
+                    nelem, Cppyy::GetMethodReturnTypeAsString(meth->GetMethod()).c_str());
+                Py_DECREF(result);
+                return nullptr;
+            }
+        }
+
+        out = (char*)view->buf;
+        ostride = view->itemsize;
+        ostore = gCasts[rkind][okind];
+    } else if (pyout) {
+        PyErr_SetString(PyExc_TypeError, "output buffer given for function returning void");
+        return nullptr;
+    } else {
+        Py_INCREF(Py_None);
+        result = Py_None;
+    }
+
+// typed loop over all elements: arguments are cast straight into the call parameters
+    std::vector<Parameter> params(nargs);
+    std::vector<cast_t> acasts(nargs);
+    for (Py_ssize_t iarg = 0; iarg < nargs; ++iarg) {
+        params[iarg].fTypeCode = gScalarInfo[kinds[iarg]].fTypeCode;
+        acasts[iarg] = gCasts[vargs[iarg].fKind][kinds[iarg]];
+    }
+
+    const Cppyy::TCppMethod_t cppmeth = meth->GetMethod();
+    const vcall_t vcall = rkind != kNotScalar ? gCalls[rkind] : VectorCallVoid;
+    ScalarValue_t retval;
+    std::string cpperr;
+    bool failed = false;
+
+#ifdef WITH_THREAD
+    PyThreadState* state = releaseGIL ? PyEval_SaveThread() : nullptr;
+#endif
+    try {
+        for (Py_ssize_t i = 0; i < nelem; ++i) {
+            for (Py_ssize_t iarg = 0; iarg < nargs; ++iarg)
+                acasts[iarg](vargs[iarg].fData + i*vargs[iarg].fStride, &params[iarg].fValue);
+            vcall(cppmeth, cppself, (size_t)nargs, params.data(), &retval);
+            if (ostore)
+                ostore((const char*)&retval, out + i*ostride);
+        }
+    } catch (std::exception& e) {
+        cpperr = e.what();
+        failed = true;
+    } catch (...) {
+        cpperr = "unhandled, unknown C++ exception";
+        failed = true;
+    }
+#ifdef WITH_THREAD
+    if (state) PyEval_RestoreThread(state);
+#endif
+
+    if (failed) {
+        if (!PyErr_Occurred())
+            PyErr_Format(PyExc_Exception, "%s (C++ exception)", cpperr.c_str());
+        Py_DECREF(result);
+        return nullptr;
+    }
+
+    return result;
+}
+
+//----------------------------------------------------------------------------
+bool CPyCppyy::IsScalarBufferCopyable(const std::string& cpptype, const Py_buffer& view)
+{
+    if (view.ndim != 1 || view.itemsize <= 0)
+        return false;
+    EScalar to = ScalarFromCppType(cpptype);
+    EScalar from = ScalarFromFormat(view.format, view.itemsize);
+    return to != kNotScalar && from != kNotScalar && IsConvertible(from, to);
+}
+
+//----------------------------------------------------------------------------
+void CPyCppyy::CopyScalarBuffer(const std::string& cpptype, void* dst, const Py_buffer& view)
+{
+// copy all elements of view to the array at dst; assumes IsScalarBufferCopyable()
+    EScalar to = ScalarFromCppType(cpptype);
+    EScalar from = ScalarFromFormat(view.format, view.itemsize);
+
+    Py_ssize_t nelem = view.len / view.itemsize;
+    Py_ssize_t stride = view.strides ? view.strides[0] : view.itemsize;
+    if (from == to && stride == view.itemsize) {
+        memcpy(dst, view.buf, view.len);
+        return;
+    }
+
+    cast_t cast = gCasts[from][to];
+    size_t tsize = gScalarInfo[to].fSize;
+    for (Py_ssize_t i = 0; i < nelem; ++i)
+        cast((const char*)view.buf + i*stride, (char*)dst + i*tsize);
+}
@@ -0,0 +1,27 @@
+#ifndef CPYCPPYY_VECTORCALL_H
+#define CPYCPPYY_VECTORCALL_H
+
+// Standard
+#include <string>
+
+
+namespace CPyCppyy {
+
+class CPPOverload;
+
+// Element-wise ("ufunc-style") calls of C++ functions taking and returning builtin
+// scalars: arguments are buffers (or python scalars, which are broadcast) and the
+// results are written to an output buffer. The overload is resolved once, on the
+// element types, after which arguments and results are converted in typed loops,
+// bypassing per-element dispatch. Implements CPPOverload.__vectorize__.
+PyObject* VectorizedCall(CPPOverload* pymeth, PyObject* args, PyObject* kwds);
+
+// Bulk copy of a 1-dim buffer of builtin scalars into an array of cpptype, with the
+// same element conversions as vectorized calls (i.e. those that need no range checks);
+// used to fill STL containers from buffers without per-element dispatch.
+bool IsScalarBufferCopyable(const std::string& cpptype, const Py_buffer& view);
+void CopyScalarBuffer(const std::string& cpptype, void* dst, const Py_buffer& view);
+
+} // namespace CPyCppyy
+
+#endif // !CPYCPPYY_VECTORCALL_H
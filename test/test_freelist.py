@@ -0,0 +1,51 @@
+import gc, sys
+from pytest import mark
+
+
+class TestFREELIST:
+    def setup_class(cls):
+        import cppyy
+        cppyy.cppdef("""\
+        namespace freelist_test {
+            struct Plain { int fData = 42; };
+            struct Finalized { int fData = 42; };
+        }""")
+
+    @mark.skipif(sys.version_info >= (3, 13) or hasattr(sys, '_is_gil_enabled'),
+                 reason="no proxy free list on p3.13 and later")
+    def test01_recycled_proxy(self):
+        """A dropped proxy is re-used for the next object of its class"""
+
+        import cppyy
+        ns = cppyy.gbl.freelist_test
+        stats = cppyy._backend._proxy_freelist_stats
+
+        o = ns.Plain()
+        del o
+        assert stats(ns.Plain)['size'] == 1
+
+        hits = stats()['hits']
+        o = ns.Plain()
+        assert stats()['hits'] == hits + 1
+        assert stats(ns.Plain)['size'] == 0
+        assert o.fData == 42
+
+    def test02_finalizer_runs_for_recycled_proxy(self):
+        """__del__ runs for every proxy, including those that could be recycled"""
+
+        import cppyy
+        ns = cppyy.gbl.freelist_test
+
+        o = ns.Finalized()      # proxy from before __del__ was added may be recycled
+        del o
+
+        calls = []
+        ns.Finalized.__del__ = lambda self: calls.append(self.fData)
+
+        for i in range(5):
+            o = ns.Finalized()
+            del o
+            gc.collect()
+        assert calls == [42]*5
+
+        del ns.Finalized.__del__
@@ -0,0 +1,102 @@
+from pytest import raises
+
+
+class TestSTLITERATORS:
+    def setup_class(cls):
+        import cppyy
+        cppyy.cppdef("""\
+        namespace stliter_test {
+            struct Pt { int x; };
+            std::vector<Pt> make_pts(int n) {
+                std::vector<Pt> v;
+                for (int i = 0; i < n; ++i) v.push_back(Pt{i});
+                return v;
+            }
+        }""")
+
+    def test01_element_proxy_reuse(self):
+        """Dropped element proxies are re-used by the vector iterator"""
+
+        import cppyy
+        v = cppyy.gbl.stliter_test.make_pts(4)
+
+        it = iter(v)
+        a = next(it)
+        ida = id(a)
+        del a                   # only the iterator holds it now
+        b = next(it)
+        c = next(it)            # same slot as a, which is re-pointed
+        assert id(c) == ida
+        assert b.x == 1
+        assert c.x == 2
+
+        assert [p.x for p in v] == [0, 1, 2, 3]
+
+    def test02_no_attribute_leaks(self):
+        """Attributes set on an element do not show up on later ones"""
+
+        import cppyy
+        v = cppyy.gbl.stliter_test.make_pts(4)
+
+        seen = []
+        for p in v:
+            assert not hasattr(p, 'tag')
+            p.tag = p.x
+            seen.append(p.x)
+        assert seen == [0, 1, 2, 3]
+
+    def test03_erase_during_iteration(self):
+        """Erasing from a node-based container while iterating does not crash"""
+
+        import cppyy
+
+        for tmpl in ('map', 'unordered_map'):
+            m = getattr(cppyy.gbl.std, tmpl)[int, int]()
+            for i in range(100): m[i] = i
+
+            with raises(RuntimeError):
+                for k in m:
+                    m.erase(k)
+            assert len(m) == 99
+
+            with raises(RuntimeError):
+                for k in m:
+                    m.clear()
+            assert len(m) == 0
+
+        s = cppyy.gbl.std.set[int]()
+        for i in range(100): s.insert(i)
+        with raises(RuntimeError):
+            for i in s:
+                s.erase(i+1)
+
+        l = cppyy.gbl.std.list[int]()
+        for i in range(100): l.push_back(i)
+        with raises(RuntimeError):
+            for i in l:
+                l.pop_back()
+
+    def test04_insert_during_iteration(self):
+        """Inserting into a container while iterating stops the iteration"""
+
+        import cppyy
+
+        d = cppyy.gbl.std.deque[int]()
+        for i in range(100): d.push_back(i)
+        with raises(RuntimeError):
+            for i in d:
+                d.push_back(i)
+        assert len(d) == 101
+
+    def test05_iterate_unchanged(self):
+        """Iteration over a container that is not modified visits every element"""
+
+        import cppyy
+
+        m = cppyy.gbl.std.map[int, int]()
+        for i in range(100): m[i] = 2*i
+        assert sorted(k for k in m) == list(range(100))
+
+        l = cppyy.gbl.std.list[int]()
+        for i in range(100): l.push_back(i)
+        assert [i for i in l] == list(range(100))
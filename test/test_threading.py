@@ -0,0 +1,69 @@
+import sys, threading
+
+
+class TestTHREADING:
+    def setup_class(cls):
+        import cppyy
+        cppyy.cppdef("""\
+        namespace threading_test {
+            struct Obj { int fData; Obj(int i) : fData(i) {} };
+            Obj* make_obj(int i) { return new Obj(i); }
+            Obj* identity(Obj* o) { return o; }
+
+            int over(int i) { return 1; }
+            int over(double d) { return 2; }
+            int over(const Obj&) { return 3; }
+        }""")
+
+    def run_threads(self, func, nthreads=8, niter=2000):
+        errors = []
+        start = threading.Barrier(nthreads)
+
+        def worker(tid):
+            try:
+                start.wait()
+                for i in range(niter):
+                    func(tid, i)
+            except Exception as e:
+                errors.append(e)
+
+        threads = [threading.Thread(target=worker, args=(t,)) for t in range(nthreads)]
+        for t in threads: t.start()
+        for t in threads: t.join()
+        assert not errors
+
+    def test01_gil_default(self):
+        """On free-threaded builds, importing the bindings re-enables the GIL"""
+
+        import cppyy
+
+        if hasattr(sys, '_is_gil_enabled') and not getattr(sys.flags, 'gil', None) == 0:
+            assert sys._is_gil_enabled()
+
+    def test02_concurrent_overload_dispatch(self):
+        """Overload resolution from several threads at once, incl. the first call"""
+
+        import cppyy
+        ns = cppyy.gbl.threading_test
+
+        def call(tid, i):
+            assert ns.over(i) == 1
+            assert ns.over(i + 0.5) == 2
+            assert ns.over(ns.Obj(i)) == 3
+
+        self.run_threads(call)
+
+    def test03_concurrent_object_tracking(self):
+        """Creation, lookup, and deletion of tracked proxies from several threads"""
+
+        import cppyy
+        ns = cppyy.gbl.threading_test
+
+        def track(tid, i):
+            o = ns.make_obj(i)
+            o.__python_owns__ = True
+            assert ns.identity(o) is o
+            assert o.fData == i
+            del o
+
+        self.run_threads(track)
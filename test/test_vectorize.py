@@ -0,0 +1,39 @@
+import array
+from pytest import raises
+
+
+class TestVECTORIZE:
+    def setup_class(cls):
+        import cppyy
+        cppyy.cppdef("""\
+        namespace vectorize_test {
+            long long add_ll(long long a, long long b) { return a+b; }
+            unsigned long long add_ull(unsigned long long a, unsigned long long b) { return a+b; }
+            int add_i(int a, int b) { return a+b; }
+        }""")
+
+    def test01_scalar_broadcast(self):
+        """Python ints are broadcast over the buffer arguments"""
+
+        import cppyy
+        ns = cppyy.gbl.vectorize_test
+
+        a = array.array('q', [1, 2, 3])
+        assert list(ns.add_ll.__vectorize__(a, 10)) == [11, 12, 13]
+
+    def test02_unsigned_out_of_signed_range(self):
+        """Unsigned values beyond the range of a signed target do not wrap around"""
+
+        import cppyy
+        ns = cppyy.gbl.vectorize_test
+
+        a = array.array('q', [1, 2, 3])
+        with raises((TypeError, OverflowError)):
+            ns.add_ll.__vectorize__(a, 2**64-1)
+
+        a = array.array('i', [1, 2, 3])
+        with raises((TypeError, OverflowError)):
+            ns.add_i.__vectorize__(a, 2**63)
+
+        a = array.array('Q', [1, 2, 3])
+        assert list(ns.add_ull.__vectorize__(a, 2**63)) == [2**63+1, 2**63+2, 2**63+3]